@@ -288,6 +288,9 @@ electron.app
           return loadSettings();
         });
         electron.ipcMain.handle('reset-all', resetAll);
+        electron.ipcMain.handle('results-cache-directory', (): string => {
+          return path.join(electron.app.getPath('userData'), 'ResultsCache');
+        });
         /* TODO: enable once our GitHub integration is fully ready.
         electron.ipcMain.handle('save-github-access-token', async (_event, token: string): Promise<boolean> => {
           return saveGitHubAccessToken(token);
@@ -123,6 +123,7 @@ electron.contextBridge.exposeInMainWorld('electronApi', {
   loadGitHubAccessToken: (): Promise<string | null> => electron.ipcRenderer.invoke('load-github-access-token'),
   loadSettings: (): Promise<ISettings> => electron.ipcRenderer.invoke('load-settings'),
   resetAll: () => electron.ipcRenderer.invoke('reset-all'),
+  resultsCacheDirectory: (): Promise<string> => electron.ipcRenderer.invoke('results-cache-directory'),
   saveGitHubAccessToken: (token: string): Promise<boolean> =>
     electron.ipcRenderer.invoke('save-github-access-token', token),
   saveSettings: (settings: ISettings) => electron.ipcRenderer.invoke('save-settings', settings),
@@ -211,6 +212,17 @@ electron.contextBridge.exposeInMainWorld('locApi', {
 
   version: () => loc.version(),
 
+  // ResultsCache API.
+
+  resultsCacheConfigure: (directory: string, maximumSize: number) => loc.resultsCacheConfigure(directory, maximumSize),
+  resultsCacheStatistics: () => loc.resultsCacheStatistics(),
+  resultsCacheClear: () => loc.resultsCacheClear(),
+
+  // Memory API.
+
+  memorySetBudget: (budget: number, spillToDisk: boolean) => loc.memorySetBudget(budget, spillToDisk),
+  memoryUsage: () => loc.memoryUsage(),
+
   // FileManager API.
 
   fileManagerUnmanage: (path: string) => loc.fileManagerUnmanage(path),
@@ -219,6 +231,7 @@ electron.contextBridge.exposeInMainWorld('locApi', {
 
   fileContents: (path: string) => loc.fileContents(path),
   fileCreate: (path: string, contents: object) => loc.fileCreate(path, contents),
+  fileOpen: (path: string, contents: object) => loc.fileOpen(path, contents),
   fileIssues: (path: string) => loc.fileIssues(path),
   fileType: (path: string) => loc.fileType(path),
   fileUiJson: (path: string) => loc.fileUiJson(path),
@@ -259,12 +272,60 @@ electron.contextBridge.exposeInMainWorld('locApi', {
   sedUniformTimeCourseSetNumberOfSteps: (documentId: number, index: number, value: number) =>
     loc.sedUniformTimeCourseSetNumberOfSteps(documentId, index, value),
 
+  // SedSimulation API.
+
+  sedSimulationOdeSolverType: (documentId: number, index: number) => loc.sedSimulationOdeSolverType(documentId, index),
+  sedSimulationSetOdeSolverType: (documentId: number, index: number, value: number) =>
+    loc.sedSimulationSetOdeSolverType(documentId, index, value),
+
   // SolverCvode API.
-  // TODO: this is only temporary until we have full support for our different solvers.
 
   solverCvodeMaximumStep: (documentId: number, index: number) => loc.solverCvodeMaximumStep(documentId, index),
   solverCvodeSetMaximumStep: (documentId: number, index: number, value: number) =>
     loc.solverCvodeSetMaximumStep(documentId, index, value),
+  solverCvodeMaximumNumberOfSteps: (documentId: number, index: number) =>
+    loc.solverCvodeMaximumNumberOfSteps(documentId, index),
+  solverCvodeSetMaximumNumberOfSteps: (documentId: number, index: number, value: number) =>
+    loc.solverCvodeSetMaximumNumberOfSteps(documentId, index, value),
+  solverCvodeIntegrationMethod: (documentId: number, index: number) =>
+    loc.solverCvodeIntegrationMethod(documentId, index),
+  solverCvodeSetIntegrationMethod: (documentId: number, index: number, value: number) =>
+    loc.solverCvodeSetIntegrationMethod(documentId, index, value),
+  solverCvodeIterationType: (documentId: number, index: number) => loc.solverCvodeIterationType(documentId, index),
+  solverCvodeSetIterationType: (documentId: number, index: number, value: number) =>
+    loc.solverCvodeSetIterationType(documentId, index, value),
+  solverCvodeLinearSolver: (documentId: number, index: number) => loc.solverCvodeLinearSolver(documentId, index),
+  solverCvodeSetLinearSolver: (documentId: number, index: number, value: number) =>
+    loc.solverCvodeSetLinearSolver(documentId, index, value),
+  solverCvodePreconditioner: (documentId: number, index: number) => loc.solverCvodePreconditioner(documentId, index),
+  solverCvodeSetPreconditioner: (documentId: number, index: number, value: number) =>
+    loc.solverCvodeSetPreconditioner(documentId, index, value),
+  solverCvodeUpperHalfBandwidth: (documentId: number, index: number) =>
+    loc.solverCvodeUpperHalfBandwidth(documentId, index),
+  solverCvodeSetUpperHalfBandwidth: (documentId: number, index: number, value: number) =>
+    loc.solverCvodeSetUpperHalfBandwidth(documentId, index, value),
+  solverCvodeLowerHalfBandwidth: (documentId: number, index: number) =>
+    loc.solverCvodeLowerHalfBandwidth(documentId, index),
+  solverCvodeSetLowerHalfBandwidth: (documentId: number, index: number, value: number) =>
+    loc.solverCvodeSetLowerHalfBandwidth(documentId, index, value),
+  solverCvodeRelativeTolerance: (documentId: number, index: number) =>
+    loc.solverCvodeRelativeTolerance(documentId, index),
+  solverCvodeSetRelativeTolerance: (documentId: number, index: number, value: number) =>
+    loc.solverCvodeSetRelativeTolerance(documentId, index, value),
+  solverCvodeAbsoluteTolerance: (documentId: number, index: number) =>
+    loc.solverCvodeAbsoluteTolerance(documentId, index),
+  solverCvodeSetAbsoluteTolerance: (documentId: number, index: number, value: number) =>
+    loc.solverCvodeSetAbsoluteTolerance(documentId, index, value),
+  solverCvodeInterpolateSolution: (documentId: number, index: number) =>
+    loc.solverCvodeInterpolateSolution(documentId, index),
+  solverCvodeSetInterpolateSolution: (documentId: number, index: number, value: boolean) =>
+    loc.solverCvodeSetInterpolateSolution(documentId, index, value),
+
+  // SolverFixedStep API.
+
+  solverFixedStepStep: (documentId: number, index: number) => loc.solverFixedStepStep(documentId, index),
+  solverFixedStepSetStep: (documentId: number, index: number, value: number) =>
+    loc.solverFixedStepSetStep(documentId, index, value),
 
   // SedInstance API.
 
@@ -277,9 +338,21 @@ electron.contextBridge.exposeInMainWorld('locApi', {
   sedInstancePauseRun: (instanceId: number) => loc.sedInstancePauseRun(instanceId),
   sedInstanceResumeRun: (instanceId: number) => loc.sedInstanceResumeRun(instanceId),
   sedInstanceStopRun: (instanceId: number) => loc.sedInstanceStopRun(instanceId),
+  sedInstanceResultBytes: (instanceId: number) => loc.sedInstanceResultBytes(instanceId),
+  sedInstanceReloadResults: (instanceId: number) => loc.sedInstanceReloadResults(instanceId),
+
+  // SedRunScheduler API.
+
+  sedRunSchedulerCreate: (documentId: number, callback: (generation: number, instanceId: number) => void) =>
+    loc.sedRunSchedulerCreate(documentId, callback),
+  sedRunSchedulerRequestRun: (documentId: number, generation: number, changes: object[]) =>
+    loc.sedRunSchedulerRequestRun(documentId, generation, changes),
+  sedRunSchedulerRelease: (documentId: number) => loc.sedRunSchedulerRelease(documentId),
 
   // SedInstanceTask API.
 
+  sedInstanceTaskResultsAvailable: (instanceId: number, index: number) =>
+    loc.sedInstanceTaskResultsAvailable(instanceId, index),
   sedInstanceTaskVoiName: (instanceId: number, index: number) => loc.sedInstanceTaskVoiName(instanceId, index),
   sedInstanceTaskVoiUnit: (instanceId: number, index: number) => loc.sedInstanceTaskVoiUnit(instanceId, index),
   sedInstanceTaskVoi: (instanceId: number, index: number) => loc.sedInstanceTaskVoi(instanceId, index),
@@ -320,5 +393,13 @@ electron.contextBridge.exposeInMainWorld('locApi', {
   sedInstanceTaskAlgebraicVariableUnit: (instanceId: number, index: number, algebraicVariableIndex: number) =>
     loc.sedInstanceTaskAlgebraicVariableUnit(instanceId, index, algebraicVariableIndex),
   sedInstanceTaskAlgebraicVariable: (instanceId: number, index: number, algebraicVariableIndex: number) =>
-    loc.sedInstanceTaskAlgebraicVariable(instanceId, index, algebraicVariableIndex)
+    loc.sedInstanceTaskAlgebraicVariable(instanceId, index, algebraicVariableIndex),
+
+  // RunStore API.
+
+  runStoreAdd: (columns: Float64Array[]) => loc.runStoreAdd(columns),
+  runStoreTrace: (runId: number, xColumn: number, yColumn: number, resolution: number) =>
+    loc.runStoreTrace(runId, xColumn, yColumn, resolution),
+  runStoreRemove: (runId: number) => loc.runStoreRemove(runId),
+  runStoreStatistics: () => loc.runStoreStatistics()
 });
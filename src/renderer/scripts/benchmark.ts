@@ -0,0 +1,469 @@
+#!/usr/bin/env bun
+
+import { spawnSync } from 'node:child_process';
+import fs from 'node:fs';
+import { createRequire } from 'node:module';
+import path from 'node:path';
+import { fileURLToPath } from 'node:url';
+
+import { parseExternalCsvData } from '../src/common/externalData';
+
+// Performance regression suite for our native node module.
+// Note: each scenario is run in its own process, so that its peak RSS is not affected by the other scenarios. Its wall
+//       time (and that of each of its phases) is the median over a number of repetitions, and the number of bytes
+//       marshalled across Node-API is the average over those repetitions. The results are compared against a baseline
+//       for the current platform and any regression makes us exit with an error (unless we are asked to update the
+//       baseline). A scenario without a baseline (e.g. on a fresh checkout) only results in a warning, unless we are
+//       asked to be strict.
+//
+// Usage: bun src/renderer/scripts/benchmark.ts [--filter=<text>] [--repetitions=<n>] [--time-tolerance=<ratio>]
+//                                              [--rss-tolerance=<ratio>] [--bytes-tolerance=<ratio>]
+//                                              [--update-baseline] [--strict]
+
+const scriptDirName = path.dirname(fileURLToPath(import.meta.url));
+const rootDirName = path.resolve(scriptDirName, '../../..');
+const modelsDirName = path.join(rootDirName, 'tests/models');
+const dataDirName = path.join(rootDirName, 'tests/data');
+const baselineFileName = path.join(rootDirName, 'tests/benchmarks/baseline.json');
+const nativeModuleFileName = path.join(rootDirName, 'dist/libOpenCOR/Release/libOpenCOR.node');
+const platform = `${process.platform}-${process.arch}`;
+const RESULT_PREFIX = 'BENCHMARK_RESULT ';
+const MINIMUM_TIME_DIFFERENCE = 1; // Milliseconds, below which a time difference is considered to be noise.
+
+// Command line arguments.
+
+const option = (name: string, defaultValue: string): string => {
+  const prefix = `--${name}=`;
+
+  return process.argv.find((arg) => arg.startsWith(prefix))?.slice(prefix.length) ?? defaultValue;
+};
+
+const scenarioName = option('scenario', '');
+const filter = option('filter', '');
+const repetitions = Math.max(1, Number(option('repetitions', '5')));
+const timeTolerance = Number(option('time-tolerance', '0.25'));
+const rssTolerance = Number(option('rss-tolerance', '0.2'));
+const bytesTolerance = Number(option('bytes-tolerance', '0'));
+const updateBaseline = process.argv.includes('--update-baseline');
+const strict = process.argv.includes('--strict');
+
+// Results.
+
+interface IScenarioResult {
+  wallTime: number;
+  phases: Record<string, number>;
+  peakRss: number;
+  napiBytes: number;
+}
+
+type IBaseline = Record<string, Record<string, IScenarioResult>>;
+
+// Access to our native node module, keeping track of the number of bytes marshalled across Node-API.
+
+let napiBytes = 0;
+
+const marshalledBytes = (value: unknown): number => {
+  if (ArrayBuffer.isView(value)) {
+    return value.byteLength;
+  }
+
+  if (typeof value === 'string') {
+    return Buffer.byteLength(value);
+  }
+
+  if (typeof value === 'number' || typeof value === 'boolean') {
+    return 8;
+  }
+
+  if (Array.isArray(value)) {
+    return value.reduce((res: number, item: unknown) => res + marshalledBytes(item), 0);
+  }
+
+  if (value && typeof value === 'object') {
+    return Object.values(value).reduce((res: number, item: unknown) => res + marshalledBytes(item), 0);
+  }
+
+  return 0;
+};
+
+// biome-ignore lint/suspicious/noExplicitAny: our native node module is untyped.
+type ILoc = Record<string, (...args: any[]) => any>;
+
+const loadLoc = (): ILoc => {
+  const loc = createRequire(import.meta.url)(nativeModuleFileName) as ILoc;
+
+  return new Proxy(loc, {
+    get(target, name: string) {
+      const func = target[name];
+
+      if (typeof func !== 'function') {
+        return func;
+      }
+
+      return (...args: unknown[]) => {
+        napiBytes += marshalledBytes(args);
+
+        const res = func(...args);
+
+        if (res instanceof Promise) {
+          return res.then((value: unknown) => {
+            napiBytes += marshalledBytes(value);
+
+            return value;
+          });
+        }
+
+        napiBytes += marshalledBytes(res);
+
+        return res;
+      };
+    }
+  });
+};
+
+// Scenarios.
+
+type IPhases = Record<string, number>;
+
+const phase = async <T>(phases: IPhases, name: string, func: () => T | Promise<T>): Promise<T> => {
+  const start = performance.now();
+  const res = await func();
+
+  phases[name] = (phases[name] ?? 0) + performance.now() - start;
+
+  return res;
+};
+
+const fetchResults = (loc: ILoc, instanceId: number): void => {
+  // Retrieve all the results of the first task of the given instance, as OpenCOR would do to plot them.
+
+  loc.sedInstanceTaskVoi(instanceId, 0);
+
+  for (const kind of ['State', 'Rate', 'Constant', 'ComputedConstant', 'AlgebraicVariable']) {
+    const count = loc[`sedInstanceTask${kind}Count`](instanceId, 0) as number;
+
+    for (let i = 0; i < count; ++i) {
+      loc[`sedInstanceTask${kind}Name`](instanceId, 0, i);
+      loc[`sedInstanceTask${kind}`](instanceId, 0, i);
+    }
+  }
+};
+
+const simulate = async (
+  loc: ILoc,
+  filePath: string,
+  contents: Uint8Array | undefined,
+  numberOfStepsFactor: number
+): Promise<IPhases> => {
+  // Load, instantiate, run, and fetch the results of the given file, end to end.
+
+  const phases: IPhases = {};
+
+  try {
+    const documentId = await phase(phases, 'load', () => {
+      loc.fileCreate(filePath, contents);
+      loc.fileIssues(filePath);
+
+      const res = loc.sedDocumentCreate(filePath) as number;
+
+      loc.sedDocumentIssues(res);
+
+      if (numberOfStepsFactor !== 1) {
+        const numberOfSteps = loc.sedUniformTimeCourseNumberOfSteps(res, 0) as number;
+
+        loc.sedUniformTimeCourseSetNumberOfSteps(res, 0, numberOfStepsFactor * numberOfSteps);
+      }
+
+      return res;
+    });
+    const instanceId = await phase(phases, 'instantiate', () => {
+      return loc.sedDocumentInstantiate(documentId) as number;
+    });
+
+    if (loc.sedInstanceHasIssues(instanceId)) {
+      return phases;
+    }
+
+    await phase(phases, 'run', () => {
+      if (loc.sedInstanceStartRun(instanceId)) {
+        loc.sedInstanceWaitForRun(instanceId);
+      }
+    });
+    await phase(phases, 'fetch', () => {
+      fetchResults(loc, instanceId);
+    });
+  } finally {
+    loc.fileManagerUnmanage(filePath);
+  }
+
+  return phases;
+};
+
+const syntheticModel = (systemCount: number, outputCount = 0): Uint8Array => {
+  // A CellML model with the given number of (slightly different) Lorenz systems and the given number of outputs, i.e.
+  // algebraic variables computed from those systems.
+
+  const ci = (name: string): string => `<ci>${name}</ci>`;
+  const cn = (value: number): string => `<cn cellml:units="dimensionless">${value}</cn>`;
+  const apply = (operator: string, ...args: string[]): string => `<apply><${operator}/>${args.join('')}</apply>`;
+  const ode = (name: string, rhs: string): string =>
+    apply('eq', `<apply><diff/><bvar>${ci('t')}</bvar>${ci(name)}</apply>`, rhs);
+  const variable = (name: string, initialValue?: number): string => {
+    const initialValueAttribute = initialValue === undefined ? '' : ` initial_value="${initialValue}"`;
+
+    return `<variable name="${name}" units="dimensionless"${initialValueAttribute}/>`;
+  };
+  const variables = [variable('t'), variable('sigma', 10), variable('rho', 28), variable('beta', 2.66667)];
+  const equations: string[] = [];
+
+  for (let i = 0; i < systemCount; ++i) {
+    const [x, y, z] = [`x${i}`, `y${i}`, `z${i}`];
+    const initialValue = 1 + i / systemCount;
+
+    variables.push(variable(x, initialValue), variable(y, initialValue), variable(z, initialValue));
+    equations.push(
+      ode(x, apply('times', ci('sigma'), apply('minus', ci(y), ci(x)))),
+      ode(y, apply('minus', apply('times', ci(x), apply('minus', ci('rho'), ci(z))), ci(y))),
+      ode(z, apply('minus', apply('times', ci(x), ci(y)), apply('times', ci('beta'), ci(z))))
+    );
+  }
+
+  for (let i = 0; i < outputCount; ++i) {
+    const output = `output${i}`;
+    const system = i % systemCount;
+
+    variables.push(variable(output));
+    equations.push(
+      apply('eq', ci(output), apply('plus', apply('times', cn(i + 1), ci(`x${system}`)), ci(`z${system}`)))
+    );
+  }
+
+  return new TextEncoder().encode(`<?xml version='1.0'?>
+<model name="synthetic" xmlns="http://www.cellml.org/cellml/1.0#" xmlns:cellml="http://www.cellml.org/cellml/1.0#">
+  <component name="main">
+    ${variables.join('\n    ')}
+    <math xmlns="http://www.w3.org/1998/Math/MathML">
+      ${equations.join('\n      ')}
+    </math>
+  </component>
+</model>`);
+};
+
+const scenarios: Record<string, (loc: ILoc) => Promise<IPhases>> = {};
+
+for (const fileName of fs.readdirSync(modelsDirName).sort()) {
+  if (/\.(cellml|sedml|omex)$/.test(fileName)) {
+    scenarios[`model:${fileName}`] = (loc) => simulate(loc, path.join(modelsDirName, fileName), undefined, 1);
+  }
+}
+
+scenarios['open:lorenz.omex'] = async (loc) => {
+  // Open a COMBINE archive asynchronously, i.e. its file, UI JSON, and SED-ML document in one go.
+
+  const phases: IPhases = {};
+  const filePath = path.join(modelsDirName, 'lorenz.omex');
+
+  await phase(phases, 'open', () => loc.fileOpen(filePath));
+
+  loc.fileManagerUnmanage(filePath);
+
+  return phases;
+};
+
+for (const fileName of fs.readdirSync(dataDirName).sort()) {
+  if (fileName.startsWith('tt04_')) {
+    scenarios[`data:${fileName}`] = async () => {
+      const phases: IPhases = {};
+      const contents = fs.readFileSync(path.join(dataDirName, fileName), 'utf8');
+
+      await phase(phases, 'parse', () => parseExternalCsvData(contents));
+
+      return phases;
+    };
+  }
+}
+
+scenarios['synthetic:long_time_course'] = (loc) =>
+  simulate(loc, path.join(modelsDirName, 'lorenz.sedml'), undefined, 20);
+scenarios['synthetic:large_model'] = (loc) => simulate(loc, '/synthetic/large_model.cellml', syntheticModel(250), 1);
+scenarios['synthetic:many_outputs'] = (loc) =>
+  simulate(loc, '/synthetic/many_outputs.cellml', syntheticModel(10, 2500), 1);
+
+// Run a scenario (in a child process) or all of them.
+
+const median = (values: number[]): number => {
+  const sortedValues = [...values].sort((value1, value2) => value1 - value2);
+  const middle = Math.floor(sortedValues.length / 2);
+
+  if (sortedValues.length % 2) {
+    return sortedValues[middle] ?? 0;
+  }
+
+  return ((sortedValues[middle - 1] ?? 0) + (sortedValues[middle] ?? 0)) / 2;
+};
+
+const runScenario = async (name: string): Promise<void> => {
+  const scenario = scenarios[name];
+
+  if (!scenario) {
+    throw new Error(`Unknown scenario '${name}'.`);
+  }
+
+  const loc = loadLoc();
+  const phasesList: IPhases[] = [];
+  const napiBytesList: number[] = [];
+
+  for (let i = 0; i < repetitions; ++i) {
+    napiBytes = 0;
+
+    phasesList.push(await scenario(loc));
+    napiBytesList.push(napiBytes);
+  }
+
+  const phases: IPhases = {};
+
+  for (const phaseName of Object.keys(phasesList[0] ?? {})) {
+    phases[phaseName] = median(phasesList.map((repetitionPhases) => repetitionPhases[phaseName] ?? 0));
+  }
+
+  const res: IScenarioResult = {
+    wallTime: median(phasesList.map((repetitionPhases) => Object.values(repetitionPhases).reduce((a, b) => a + b, 0))),
+    phases,
+    peakRss: process.resourceUsage().maxRSS * 1024,
+    napiBytes: Math.round(napiBytesList.reduce((a, b) => a + b, 0) / napiBytesList.length)
+  };
+
+  console.log(`${RESULT_PREFIX}${JSON.stringify(res)}`);
+};
+
+const regressions = (name: string, result: IScenarioResult, baseline: IScenarioResult): string[] => {
+  const res: string[] = [];
+  const check = (metric: string, value: number, baselineValue: number, tolerance: number, isTime: boolean): void => {
+    if (value > baselineValue * (1 + tolerance) && (!isTime || value - baselineValue > MINIMUM_TIME_DIFFERENCE)) {
+      res.push(
+        `${name}: ${metric} went from ${baselineValue.toFixed(isTime ? 2 : 0)} to ${value.toFixed(isTime ? 2 : 0)} (+${(
+          (100 * (value - baselineValue)) / baselineValue
+        ).toFixed(1)}%, tolerance: ${(100 * tolerance).toFixed(1)}%).`
+      );
+    }
+  };
+
+  check('wall time (ms)', result.wallTime, baseline.wallTime, timeTolerance, true);
+
+  for (const [phaseName, value] of Object.entries(result.phases)) {
+    const baselineValue = baseline.phases[phaseName];
+
+    if (baselineValue !== undefined) {
+      check(`${phaseName} time (ms)`, value, baselineValue, timeTolerance, true);
+    }
+  }
+
+  check('peak RSS (bytes)', result.peakRss, baseline.peakRss, rssTolerance, false);
+  check('N-API bytes', result.napiBytes, baseline.napiBytes, bytesTolerance, false);
+
+  return res;
+};
+
+const runAllScenarios = (): void => {
+  if (!fs.existsSync(nativeModuleFileName)) {
+    console.error(`OpenCOR: the native node module could not be found (${nativeModuleFileName}).`);
+
+    process.exit(1);
+  }
+
+  const baseline: IBaseline = fs.existsSync(baselineFileName)
+    ? (JSON.parse(fs.readFileSync(baselineFileName, 'utf8')) as IBaseline)
+    : {};
+  const platformBaseline = baseline[platform] ?? {};
+  const allRegressions: string[] = [];
+  const missingBaselines: string[] = [];
+  let hasFailures = false;
+
+  for (const name of Object.keys(scenarios)) {
+    if (!name.includes(filter)) {
+      continue;
+    }
+
+    const child = spawnSync(
+      process.execPath,
+      [fileURLToPath(import.meta.url), `--scenario=${name}`, `--repetitions=${repetitions}`],
+      {
+        encoding: 'utf8',
+        maxBuffer: 64 * 1024 * 1024
+      }
+    );
+    const resultLine = child.stdout
+      ?.split('\n')
+      .find((line) => line.startsWith(RESULT_PREFIX))
+      ?.slice(RESULT_PREFIX.length);
+
+    if (child.status !== 0 || !resultLine) {
+      console.error(`FAILED: ${name}\n${child.stderr}`);
+
+      hasFailures = true;
+
+      continue;
+    }
+
+    const res = JSON.parse(resultLine) as IScenarioResult;
+    const scenarioBaseline = platformBaseline[name];
+
+    const phases = Object.entries(res.phases)
+      .map(([phaseName, value]) => `${phaseName}: ${value.toFixed(2)} ms`)
+      .join(', ');
+
+    const peakRss = (res.peakRss / 1048576).toFixed(1);
+
+    console.log(
+      `${name}: ${res.wallTime.toFixed(2)} ms, ${peakRss} MB peak RSS, ${res.napiBytes} N-API bytes (${phases})` +
+        (scenarioBaseline ? '' : ' [no baseline]')
+    );
+
+    if (scenarioBaseline) {
+      allRegressions.push(...regressions(name, res, scenarioBaseline));
+    } else {
+      missingBaselines.push(name);
+    }
+
+    platformBaseline[name] = res;
+  }
+
+  if (updateBaseline) {
+    baseline[platform] = platformBaseline;
+
+    fs.mkdirSync(path.dirname(baselineFileName), { recursive: true });
+    fs.writeFileSync(baselineFileName, `${JSON.stringify(baseline, null, 2)}\n`);
+
+    console.log(`The baseline for ${platform} has been updated.`);
+  }
+
+  if (allRegressions.length) {
+    console.error(`\n${allRegressions.length} PERFORMANCE REGRESSION(S) FOUND:`);
+
+    for (const regression of allRegressions) {
+      console.error(`  REGRESSION: ${regression}`);
+    }
+  }
+
+  if (missingBaselines.length && !updateBaseline) {
+    const log = strict ? console.error : console.warn;
+
+    log(`\n${missingBaselines.length} SCENARIO(S) WITHOUT A BASELINE FOR ${platform}:`);
+
+    for (const missingBaseline of missingBaselines) {
+      log(`  NO BASELINE: ${missingBaseline}`);
+    }
+
+    log('Run the benchmark with --update-baseline to record a baseline for them.');
+  }
+
+  if (hasFailures || ((allRegressions.length || (strict && missingBaselines.length)) && !updateBaseline)) {
+    process.exit(1);
+  }
+};
+
+if (scenarioName) {
+  await runScenario(scenarioName);
+} else {
+  runAllScenarios();
+}
@@ -34,6 +34,7 @@ interface IElectronApi {
   loadGitHubAccessToken: () => Promise<string | null>;
   loadSettings: () => Promise<ISettings>;
   resetAll: () => void;
+  resultsCacheDirectory: () => Promise<string>;
   saveGitHubAccessToken: (token: string) => Promise<boolean>;
   saveSettings: (settings: ISettings) => void;
 
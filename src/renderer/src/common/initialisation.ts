@@ -56,6 +56,14 @@ const totalNbOfSteps =
 
 const libOpenCORWasmBaseUrl = `https://opencor.ws/libopencor/downloads/wasm/${__LIBOPENCOR_WASM_VERSION__}`;
 
+// The maximum size of our results cache (512 MiB).
+
+const RESULTS_CACHE_MAXIMUM_SIZE = 512 * 1024 * 1024;
+
+// The memory budget for the results of our simulations (1 GiB).
+
+const MEMORY_BUDGET = 1024 * 1024 * 1024;
+
 // Import and instantiate libOpenCOR.
 
 const importAndInstantiateLibOpenCOR = async (libOpenCORJSUrl: string): Promise<void> => {
@@ -88,6 +96,18 @@ export const initialiseLocApi = async (): Promise<void> => {
 
     // @ts-expect-error (window.locApi is defined)
     locApi.setCppLocApi(window.locApi);
+
+    // Enable our results cache, which lives in our user data folder.
+
+    try {
+      locApi.resultsCacheConfigure((await electronApi?.resultsCacheDirectory()) ?? '', RESULTS_CACHE_MAXIMUM_SIZE);
+    } catch (error: unknown) {
+      console.warn('OpenCOR: failed to enable the results cache:', common.formatError(error));
+    }
+
+    // Limit the memory used by the results of our simulations, spilling the least recently used ones to disk.
+
+    locApi.memorySetBudget(MEMORY_BUDGET, true);
   } else {
     // We are running OpenCOR's Web app, so we must import libOpenCOR's WebAssembly module and instantiate it.
 
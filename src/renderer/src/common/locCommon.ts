@@ -221,7 +221,7 @@ export const file = (
             const fileContents = new Uint8Array(arrayBuffer);
 
             resolve(
-              new locApi.File(filePath(fileFilePathOrFileContents, dataUrlFileName, dataUrlCounter), fileContents)
+              locApi.File.open(filePath(fileFilePathOrFileContents, dataUrlFileName, dataUrlCounter), fileContents)
             );
           })
           .catch((error: unknown) => {
@@ -232,7 +232,7 @@ export const file = (
 
     return new Promise((resolve, reject) => {
       if (electronApi) {
-        resolve(new locApi.File(filePath(fileFilePathOrFileContents, dataUrlFileName, dataUrlCounter)));
+        resolve(locApi.File.open(filePath(fileFilePathOrFileContents, dataUrlFileName, dataUrlCounter)));
       } else {
         reject(new Error('Local files cannot be opened.'));
       }
@@ -242,7 +242,7 @@ export const file = (
   if (fileFilePathOrFileContents instanceof Uint8Array) {
     return new Promise((resolve) => {
       resolve(
-        new locApi.File(
+        locApi.File.open(
           filePath(fileFilePathOrFileContents, dataUrlFileName, dataUrlCounter),
           fileFilePathOrFileContents
         )
@@ -256,7 +256,7 @@ export const file = (
       .then((arrayBuffer) => {
         const fileContents = new Uint8Array(arrayBuffer);
 
-        resolve(new locApi.File(filePath(fileFilePathOrFileContents, dataUrlFileName, dataUrlCounter), fileContents));
+        resolve(locApi.File.open(filePath(fileFilePathOrFileContents, dataUrlFileName, dataUrlCounter), fileContents));
       })
       .catch((error: unknown) => {
         reject(new Error(common.formatError(error)));
@@ -1,9 +1,31 @@
 import type { MainModule as IWasmLocApi } from '@opencor/libopencor-types';
 
-import type { EFileType } from './locFileApi';
+import type { EFileType, ICppFileOpenResult } from './locFileApi';
 import type { IIssue } from './locLoggerApi';
+import type { IMemoryUsage } from './locMemoryApi';
+import type { IResultsCacheStatistics } from './locResultsCacheApi';
+import type { IRunStoreStatistics, IRunStoreTrace } from './locRunStoreApi';
+import type {
+  ESolverCvodeIntegrationMethod,
+  ESolverCvodeIterationType,
+  ESolverCvodeLinearSolver,
+  ESolverCvodePreconditioner,
+  ESolverType,
+  ISedModelChange
+} from './locSedApi';
 
 export interface ICppLocApi {
+  // ResultsCache API.
+
+  resultsCacheConfigure: (directory: string, maximumSize: number) => void;
+  resultsCacheStatistics: () => IResultsCacheStatistics;
+  resultsCacheClear: () => void;
+
+  // Memory API.
+
+  memorySetBudget: (budget: number, spillToDisk: boolean) => void;
+  memoryUsage: () => IMemoryUsage;
+
   // FileManager API.
 
   fileManagerUnmanage: (path: string) => void;
@@ -12,6 +34,7 @@ export interface ICppLocApi {
 
   fileContents: (path: string) => Uint8Array;
   fileCreate: (path: string, contents?: Uint8Array) => void;
+  fileOpen: (path: string, contents?: Uint8Array) => Promise<ICppFileOpenResult>;
   fileIssues: (path: string) => IIssue[];
   fileType: (path: string) => EFileType;
   fileUiJson: (path: string) => Uint8Array | undefined;
@@ -53,11 +76,40 @@ export interface ICppLocApi {
   sedUniformTimeCourseNumberOfSteps: (documentId: number, index: number) => number;
   sedUniformTimeCourseSetNumberOfSteps: (documentId: number, index: number, value: number) => void;
 
+  // SedSimulation API.
+
+  sedSimulationOdeSolverType: (documentId: number, index: number) => ESolverType;
+  sedSimulationSetOdeSolverType: (documentId: number, index: number, value: ESolverType) => void;
+
   // SolverCvode API.
-  // TODO: this is only temporary until we have full support for our different solvers.
 
-  solverCvodeMaximumStep: (documentId: number, index: number) => number;
+  solverCvodeMaximumStep: (documentId: number, index: number) => number | undefined;
   solverCvodeSetMaximumStep: (documentId: number, index: number, value: number) => void;
+  solverCvodeMaximumNumberOfSteps: (documentId: number, index: number) => number | undefined;
+  solverCvodeSetMaximumNumberOfSteps: (documentId: number, index: number, value: number) => void;
+  solverCvodeIntegrationMethod: (documentId: number, index: number) => ESolverCvodeIntegrationMethod | undefined;
+  solverCvodeSetIntegrationMethod: (documentId: number, index: number, value: ESolverCvodeIntegrationMethod) => void;
+  solverCvodeIterationType: (documentId: number, index: number) => ESolverCvodeIterationType | undefined;
+  solverCvodeSetIterationType: (documentId: number, index: number, value: ESolverCvodeIterationType) => void;
+  solverCvodeLinearSolver: (documentId: number, index: number) => ESolverCvodeLinearSolver | undefined;
+  solverCvodeSetLinearSolver: (documentId: number, index: number, value: ESolverCvodeLinearSolver) => void;
+  solverCvodePreconditioner: (documentId: number, index: number) => ESolverCvodePreconditioner | undefined;
+  solverCvodeSetPreconditioner: (documentId: number, index: number, value: ESolverCvodePreconditioner) => void;
+  solverCvodeUpperHalfBandwidth: (documentId: number, index: number) => number | undefined;
+  solverCvodeSetUpperHalfBandwidth: (documentId: number, index: number, value: number) => void;
+  solverCvodeLowerHalfBandwidth: (documentId: number, index: number) => number | undefined;
+  solverCvodeSetLowerHalfBandwidth: (documentId: number, index: number, value: number) => void;
+  solverCvodeRelativeTolerance: (documentId: number, index: number) => number | undefined;
+  solverCvodeSetRelativeTolerance: (documentId: number, index: number, value: number) => void;
+  solverCvodeAbsoluteTolerance: (documentId: number, index: number) => number | undefined;
+  solverCvodeSetAbsoluteTolerance: (documentId: number, index: number, value: number) => void;
+  solverCvodeInterpolateSolution: (documentId: number, index: number) => boolean | undefined;
+  solverCvodeSetInterpolateSolution: (documentId: number, index: number, value: boolean) => void;
+
+  // SolverFixedStep API.
+
+  solverFixedStepStep: (documentId: number, index: number) => number | undefined;
+  solverFixedStepSetStep: (documentId: number, index: number, value: number) => void;
 
   // SedInstance API.
 
@@ -70,9 +122,18 @@ export interface ICppLocApi {
   sedInstancePauseRun: (instanceId: number) => void;
   sedInstanceResumeRun: (instanceId: number) => void;
   sedInstanceStopRun: (instanceId: number) => void;
+  sedInstanceResultBytes: (instanceId: number) => number;
+  sedInstanceReloadResults: (instanceId: number) => Promise<boolean>;
+
+  // SedRunScheduler API.
+
+  sedRunSchedulerCreate: (documentId: number, callback: (generation: number, instanceId: number) => void) => void;
+  sedRunSchedulerRequestRun: (documentId: number, generation: number, changes: ISedModelChange[]) => void;
+  sedRunSchedulerRelease: (documentId: number) => void;
 
   // SedInstanceTask API.
 
+  sedInstanceTaskResultsAvailable: (instanceId: number, index: number) => boolean;
   sedInstanceTaskVoiName: (instanceId: number, index: number) => string;
   sedInstanceTaskVoiUnit: (instanceId: number, index: number) => string;
   sedInstanceTaskVoi: (instanceId: number, index: number) => Float64Array;
@@ -97,6 +158,13 @@ export interface ICppLocApi {
   sedInstanceTaskAlgebraicVariableUnit: (instanceId: number, index: number, algebraicVariableIndex: number) => string;
   sedInstanceTaskAlgebraicVariable: (instanceId: number, index: number, algebraicVariableIndex: number) => Float64Array;
 
+  // RunStore API.
+
+  runStoreAdd: (columns: Float64Array[]) => number;
+  runStoreTrace: (runId: number, xColumn: number, yColumn: number, resolution: number) => IRunStoreTrace;
+  runStoreRemove: (runId: number) => void;
+  runStoreStatistics: () => IRunStoreStatistics;
+
   // Version API.
 
   version: () => string;
@@ -123,16 +191,49 @@ export { EIssueType, type IIssue, wasmIssuesToIssues } from './locLoggerApi';
 
 export { EFileType, File, fileManager } from './locFileApi';
 
+// Results cache API.
+
+export {
+  type IResultsCacheStatistics,
+  resultsCacheClear,
+  resultsCacheConfigure,
+  resultsCacheStatistics
+} from './locResultsCacheApi';
+
+// Memory API.
+
+export { type IMemoryUsage, memorySetBudget, memoryUsage } from './locMemoryApi';
+
 // SED-ML API.
 
 export {
   ESedSimulationType,
+  ESolverCvodeIntegrationMethod,
+  ESolverCvodeIterationType,
+  ESolverCvodeLinearSolver,
+  ESolverCvodePreconditioner,
+  ESolverType,
+  type ISedModelChange,
   SedDocument,
   SedInstance,
   SedInstanceTask,
-  SedUniformTimeCourse
+  SedRunScheduler,
+  SedUniformTimeCourse,
+  SolverCvode,
+  SolverFixedStep
 } from './locSedApi';
 
+// Run store API.
+
+export {
+  type IRunStoreStatistics,
+  type IRunStoreTrace,
+  runStoreAdd,
+  runStoreRemove,
+  runStoreStatistics,
+  runStoreTrace
+} from './locRunStoreApi';
+
 // UI JSON API.
 
 export {
@@ -96,15 +96,32 @@ export enum EFileType {
   IRRETRIEVABLE_FILE
 }
 
+// The result of opening a file asynchronously with the C++ version of libOpenCOR.
+// Note: the SED-ML document that gets created when opening a file asynchronously is kept by the C++ version of
+//       libOpenCOR until the file's document() method is first called or the file is closed.
+
+export interface ICppFileOpenResult {
+  issues: IIssue[];
+  uiJson?: Uint8Array;
+}
+
 export class File {
   _path: string;
   _wasmFile: IWasmFile = {} as IWasmFile;
   _issues: IIssue[] = [];
+  _cppOpenResult: ICppFileOpenResult | null = null;
 
-  constructor(path: string, contents: Uint8Array | undefined = undefined) {
+  constructor(
+    path: string,
+    contents: Uint8Array | undefined = undefined,
+    cppOpenResult: ICppFileOpenResult | null = null
+  ) {
     this._path = path;
 
-    if (cppVersion()) {
+    if (cppOpenResult) {
+      this._cppOpenResult = cppOpenResult;
+      this._issues = cppOpenResult.issues;
+    } else if (cppVersion()) {
       _cppLocApi.fileCreate(path, contents);
 
       this._issues = _cppLocApi.fileIssues(path);
@@ -124,6 +141,17 @@ export class File {
     }
   }
 
+  static async open(path: string, contents: Uint8Array | undefined = undefined): Promise<File> {
+    // Open the file asynchronously with the C++ version of libOpenCOR, i.e. have its archive (if any) decompressed and
+    // its SED-ML document created away from the JavaScript thread.
+
+    if (cppVersion()) {
+      return new File(path, contents, await _cppLocApi.fileOpen(path, contents));
+    }
+
+    return new File(path, contents);
+  }
+
   type(): EFileType {
     return cppVersion() ? _cppLocApi.fileType(this._path) : this._wasmFile.type.value;
   }
@@ -148,7 +176,7 @@ export class File {
     let uiJsonContents: Uint8Array | undefined;
 
     if (cppVersion()) {
-      uiJsonContents = _cppLocApi.fileUiJson(this._path);
+      uiJsonContents = this._cppOpenResult ? this._cppOpenResult.uiJson : _cppLocApi.fileUiJson(this._path);
 
       if (!uiJsonContents) {
         return undefined;
@@ -0,0 +1,37 @@
+import { _cppLocApi, cppVersion } from './locApi';
+
+// Memory API.
+// Note: memory accounting is only available with the C++ version of libOpenCOR. By default, there is no memory budget,
+//       but OpenCOR sets one at startup (see initialiseLocApi()). With a budget, the least recently used results get
+//       evicted whenever the results of our instances exceed the budget, either by being dropped or by being spilled
+//       (in the background) to a compressed temporary file, from which they can be reloaded asynchronously. The
+//       budget and the usage are process-wide, i.e. they cover all the environments (e.g. worker threads) in which
+//       libOpenCOR is loaded.
+
+export interface IMemoryUsage {
+  budget: number;
+  totalBytes: number;
+  residentCount: number;
+  evictedCount: number;
+  spilledCount: number;
+  spilledBytes: number;
+}
+
+export const memorySetBudget = (budget: number, spillToDisk: boolean): void => {
+  if (cppVersion()) {
+    _cppLocApi.memorySetBudget(budget, spillToDisk);
+  }
+};
+
+export const memoryUsage = (): IMemoryUsage => {
+  return cppVersion()
+    ? _cppLocApi.memoryUsage()
+    : {
+        budget: 0,
+        totalBytes: 0,
+        residentCount: 0,
+        evictedCount: 0,
+        spilledCount: 0,
+        spilledBytes: 0
+      };
+};
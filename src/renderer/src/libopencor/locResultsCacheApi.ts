@@ -0,0 +1,41 @@
+import { _cppLocApi, cppVersion } from './locApi';
+
+// Results cache API.
+// Note: the results cache is only available with the C++ version of libOpenCOR. It is disabled until it gets
+//       configured with a non-empty directory, which OpenCOR does at startup using a folder in its user data folder
+//       (see initialiseLocApi()). It holds the results of simulations (rather than
+//       compiled code), keyed on the SED-ML document, the model files (including the files they import), the version
+//       of libOpenCOR, and the CPU features. A hit means that the model gets neither instantiated nor simulated,
+//       which only happens when a previously seen combination of parameter values and simulation settings comes back.
+
+export interface IResultsCacheStatistics {
+  hits: number;
+  misses: number;
+  evictions: number;
+  entryCount: number;
+  size: number;
+}
+
+export const resultsCacheConfigure = (directory: string, maximumSize: number): void => {
+  if (cppVersion()) {
+    _cppLocApi.resultsCacheConfigure(directory, maximumSize);
+  }
+};
+
+export const resultsCacheStatistics = (): IResultsCacheStatistics => {
+  return cppVersion()
+    ? _cppLocApi.resultsCacheStatistics()
+    : {
+        hits: 0,
+        misses: 0,
+        evictions: 0,
+        entryCount: 0,
+        size: 0
+      };
+};
+
+export const resultsCacheClear = (): void => {
+  if (cppVersion()) {
+    _cppLocApi.resultsCacheClear();
+  }
+};
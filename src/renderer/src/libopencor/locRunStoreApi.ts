@@ -0,0 +1,47 @@
+import { _cppLocApi, cppVersion } from './locApi';
+
+// Run store API.
+// Note: the run store is only available with the C++ version of libOpenCOR. It keeps columns of values (e.g. the X and
+//       Y values of the traces of a tracked run) in a compressed form and decompresses pairs of them on demand,
+//       decimated to a given resolution (i.e. number of buckets, each of which is reduced to its minimum and maximum Y
+//       values). A resolution of zero means no decimation.
+
+export interface IRunStoreTrace {
+  x: Float64Array;
+  y: Float64Array;
+}
+
+export interface IRunStoreStatistics {
+  runCount: number;
+  rawBytes: number;
+  compressedBytes: number;
+}
+
+export const runStoreAdd = (columns: Float64Array[]): number => {
+  return cppVersion() ? _cppLocApi.runStoreAdd(columns) : -1;
+};
+
+export const runStoreTrace = (runId: number, xColumn: number, yColumn: number, resolution: number): IRunStoreTrace => {
+  return cppVersion()
+    ? _cppLocApi.runStoreTrace(runId, xColumn, yColumn, resolution)
+    : {
+        x: new Float64Array(0),
+        y: new Float64Array(0)
+      };
+};
+
+export const runStoreRemove = (runId: number): void => {
+  if (cppVersion()) {
+    _cppLocApi.runStoreRemove(runId);
+  }
+};
+
+export const runStoreStatistics = (): IRunStoreStatistics => {
+  return cppVersion()
+    ? _cppLocApi.runStoreStatistics()
+    : {
+        runCount: 0,
+        rawBytes: 0,
+        compressedBytes: 0
+      };
+};
@@ -40,6 +40,8 @@ export class SedDocument {
 
   constructor(filePath: string, wasmFile: IWasmFile) {
     // Create the SED-ML document.
+    // Note: with the C++ version of libOpenCOR, we get the SED-ML document that was created when opening the file
+    //       asynchronously, if it hasn't been used yet.
 
     if (cppVersion()) {
       this._cppDocumentId = _cppLocApi.sedDocumentCreate(filePath);
@@ -182,11 +184,21 @@ export class SedDocument {
     return new SedInstance(this._cppDocumentId, this._wasmSedDocument);
   }
 
+  runScheduler(): SedRunScheduler {
+    return new SedRunScheduler(this._cppDocumentId);
+  }
+
   serialise(): string {
     return cppVersion() ? _cppLocApi.sedDocumentSerialise(this._cppDocumentId) : this._wasmSedDocument.serialise();
   }
 }
 
+export interface ISedModelChange {
+  componentName: string;
+  variableName: string;
+  newValue: string;
+}
+
 export class SedModel extends SedIndex {
   private _cppDocumentId: number;
   private _wasmSedModel: IWasmSedModel = {} as IWasmSedModel;
@@ -336,9 +348,76 @@ export class SedUniformTimeCourse extends SedSimulation {
     }
   }
 
+  odeSolverType(): ESolverType {
+    if (cppVersion()) {
+      return _cppLocApi.sedSimulationOdeSolverType(this._cppDocumentId, this._index);
+    }
+
+    switch (this._wasmSedUniformTimeCourse.odeSolver?.constructor.name) {
+      case 'SolverForwardEuler':
+        return ESolverType.FORWARD_EULER;
+      case 'SolverFourthOrderRungeKutta':
+        return ESolverType.FOURTH_ORDER_RUNGE_KUTTA;
+      case 'SolverHeun':
+        return ESolverType.HEUN;
+      case 'SolverSecondOrderRungeKutta':
+        return ESolverType.SECOND_ORDER_RUNGE_KUTTA;
+      case 'SolverCvode':
+        return ESolverType.CVODE;
+      default:
+        return ESolverType.NONE;
+    }
+  }
+
+  // Note: changing the type of ODE solver is only available with the C++ version of libOpenCOR. An invalid type
+  //       (including ESolverType.NONE) is ignored.
+
+  setOdeSolverType(value: ESolverType): void {
+    if (cppVersion()) {
+      _cppLocApi.sedSimulationSetOdeSolverType(this._cppDocumentId, this._index, value);
+    }
+  }
+
   cvode(): SolverCvode {
     return new SolverCvode(this._cppDocumentId, this._wasmSedUniformTimeCourse, this._index);
   }
+
+  fixedStep(): SolverFixedStep {
+    return new SolverFixedStep(this._cppDocumentId, this._index);
+  }
+}
+
+export enum ESolverType {
+  NONE = -1,
+  CVODE,
+  FORWARD_EULER,
+  FOURTH_ORDER_RUNGE_KUTTA,
+  HEUN,
+  SECOND_ORDER_RUNGE_KUTTA
+}
+
+export enum ESolverCvodeIntegrationMethod {
+  ADAMS_MOULTON,
+  BDF
+}
+
+export enum ESolverCvodeIterationType {
+  FUNCTIONAL,
+  NEWTON
+}
+
+export enum ESolverCvodeLinearSolver {
+  DENSE,
+  BANDED,
+  DIAGONAL,
+  GMRES,
+  BICGSTAB,
+  TFQMR
+}
+
+export enum ESolverCvodePreconditioner {
+  NO,
+  BANDED
 }
 
 export class SolverCvode extends SedIndex {
@@ -355,9 +434,10 @@ export class SolverCvode extends SedIndex {
     }
   }
 
-  // TODO: this is only temporary until we have full support for our different solvers.
+  // Note: with the C++ version of libOpenCOR, the getters return undefined if the ODE solver of the simulation is not
+  //       (or no longer) CVODE.
 
-  maximumStep(): number {
+  maximumStep(): number | undefined {
     return cppVersion()
       ? _cppLocApi.solverCvodeMaximumStep(this._cppDocumentId, this._index)
       : this._wasmSolverCvode.maximumStep;
@@ -370,6 +450,132 @@ export class SolverCvode extends SedIndex {
       this._wasmSolverCvode.maximumStep = value;
     }
   }
+
+  // Note: the following properties are only available with the C++ version of libOpenCOR. With the WASM version of
+  //       libOpenCOR, their getters return undefined while their setters do nothing.
+
+  maximumNumberOfSteps(): number | undefined {
+    return cppVersion() ? _cppLocApi.solverCvodeMaximumNumberOfSteps(this._cppDocumentId, this._index) : undefined;
+  }
+
+  setMaximumNumberOfSteps(value: number): void {
+    if (cppVersion()) {
+      _cppLocApi.solverCvodeSetMaximumNumberOfSteps(this._cppDocumentId, this._index, value);
+    }
+  }
+
+  integrationMethod(): ESolverCvodeIntegrationMethod | undefined {
+    return cppVersion() ? _cppLocApi.solverCvodeIntegrationMethod(this._cppDocumentId, this._index) : undefined;
+  }
+
+  setIntegrationMethod(value: ESolverCvodeIntegrationMethod): void {
+    if (cppVersion()) {
+      _cppLocApi.solverCvodeSetIntegrationMethod(this._cppDocumentId, this._index, value);
+    }
+  }
+
+  iterationType(): ESolverCvodeIterationType | undefined {
+    return cppVersion() ? _cppLocApi.solverCvodeIterationType(this._cppDocumentId, this._index) : undefined;
+  }
+
+  setIterationType(value: ESolverCvodeIterationType): void {
+    if (cppVersion()) {
+      _cppLocApi.solverCvodeSetIterationType(this._cppDocumentId, this._index, value);
+    }
+  }
+
+  linearSolver(): ESolverCvodeLinearSolver | undefined {
+    return cppVersion() ? _cppLocApi.solverCvodeLinearSolver(this._cppDocumentId, this._index) : undefined;
+  }
+
+  setLinearSolver(value: ESolverCvodeLinearSolver): void {
+    if (cppVersion()) {
+      _cppLocApi.solverCvodeSetLinearSolver(this._cppDocumentId, this._index, value);
+    }
+  }
+
+  preconditioner(): ESolverCvodePreconditioner | undefined {
+    return cppVersion() ? _cppLocApi.solverCvodePreconditioner(this._cppDocumentId, this._index) : undefined;
+  }
+
+  setPreconditioner(value: ESolverCvodePreconditioner): void {
+    if (cppVersion()) {
+      _cppLocApi.solverCvodeSetPreconditioner(this._cppDocumentId, this._index, value);
+    }
+  }
+
+  upperHalfBandwidth(): number | undefined {
+    return cppVersion() ? _cppLocApi.solverCvodeUpperHalfBandwidth(this._cppDocumentId, this._index) : undefined;
+  }
+
+  setUpperHalfBandwidth(value: number): void {
+    if (cppVersion()) {
+      _cppLocApi.solverCvodeSetUpperHalfBandwidth(this._cppDocumentId, this._index, value);
+    }
+  }
+
+  lowerHalfBandwidth(): number | undefined {
+    return cppVersion() ? _cppLocApi.solverCvodeLowerHalfBandwidth(this._cppDocumentId, this._index) : undefined;
+  }
+
+  setLowerHalfBandwidth(value: number): void {
+    if (cppVersion()) {
+      _cppLocApi.solverCvodeSetLowerHalfBandwidth(this._cppDocumentId, this._index, value);
+    }
+  }
+
+  relativeTolerance(): number | undefined {
+    return cppVersion() ? _cppLocApi.solverCvodeRelativeTolerance(this._cppDocumentId, this._index) : undefined;
+  }
+
+  setRelativeTolerance(value: number): void {
+    if (cppVersion()) {
+      _cppLocApi.solverCvodeSetRelativeTolerance(this._cppDocumentId, this._index, value);
+    }
+  }
+
+  absoluteTolerance(): number | undefined {
+    return cppVersion() ? _cppLocApi.solverCvodeAbsoluteTolerance(this._cppDocumentId, this._index) : undefined;
+  }
+
+  setAbsoluteTolerance(value: number): void {
+    if (cppVersion()) {
+      _cppLocApi.solverCvodeSetAbsoluteTolerance(this._cppDocumentId, this._index, value);
+    }
+  }
+
+  interpolateSolution(): boolean | undefined {
+    return cppVersion() ? _cppLocApi.solverCvodeInterpolateSolution(this._cppDocumentId, this._index) : undefined;
+  }
+
+  setInterpolateSolution(value: boolean): void {
+    if (cppVersion()) {
+      _cppLocApi.solverCvodeSetInterpolateSolution(this._cppDocumentId, this._index, value);
+    }
+  }
+}
+
+// Our fixed-step ODE solvers, i.e. forward Euler, fourth-order Runge-Kutta, Heun, and second-order Runge-Kutta.
+// Note: this is only available with the C++ version of libOpenCOR.
+
+export class SolverFixedStep extends SedIndex {
+  private _cppDocumentId: number;
+
+  constructor(cppDocumentId: number, index: number) {
+    super(index);
+
+    this._cppDocumentId = cppDocumentId;
+  }
+
+  step(): number | undefined {
+    return cppVersion() ? _cppLocApi.solverFixedStepStep(this._cppDocumentId, this._index) : undefined;
+  }
+
+  setStep(value: number): void {
+    if (cppVersion()) {
+      _cppLocApi.solverFixedStepSetStep(this._cppDocumentId, this._index, value);
+    }
+  }
 }
 
 export enum ESedInstanceStatus {
@@ -382,9 +588,9 @@ export class SedInstance {
   private _cppInstanceId: number = -1;
   private _wasmSedInstance: IWasmSedInstance = {} as IWasmSedInstance;
 
-  constructor(cppDocumentId: number, wasmSedDocument: IWasmSedDocument) {
+  constructor(cppDocumentId: number, wasmSedDocument: IWasmSedDocument, cppInstanceId?: number) {
     if (cppVersion()) {
-      this._cppInstanceId = _cppLocApi.sedDocumentInstantiate(cppDocumentId);
+      this._cppInstanceId = cppInstanceId ?? _cppLocApi.sedDocumentInstantiate(cppDocumentId);
     } else {
       this._wasmSedInstance = vue.markRaw(wasmSedDocument.instantiate() as IWasmSedInstance);
     }
@@ -443,6 +649,68 @@ export class SedInstance {
       this._wasmSedInstance.stopRun();
     }
   }
+
+  resultBytes(): number {
+    // Note: memory accounting is only available with the C++ version of libOpenCOR.
+
+    return cppVersion() ? _cppLocApi.sedInstanceResultBytes(this._cppInstanceId) : 0;
+  }
+
+  reloadResults(): Promise<boolean> {
+    // Note: results may only get evicted with the C++ version of libOpenCOR, in which case they can only be reloaded
+    //       if they were spilled to disk. Otherwise, the simulation needs to be run again to get them back.
+
+    return cppVersion() ? _cppLocApi.sedInstanceReloadResults(this._cppInstanceId) : Promise.resolve(true);
+  }
+}
+
+// A latest-wins scheduler for the runs of a SED-ML document.
+// Note: this is only available with the C++ version of libOpenCOR. Each run request supersedes any previous one, which
+//       gets cancelled natively, and only the newest run to complete gets reported. The scheduler works on its own
+//       copy of the document, using the simulation and solver settings that our document has when a run is requested.
+//       The instance of a reported run gets released natively once a newer run gets reported or once the scheduler
+//       gets released, so only the latest instance may be used.
+
+export class SedRunScheduler {
+  private _cppDocumentId: number;
+  private _generation = 0;
+  private _resolve: ((instance: SedInstance | null) => void) | null = null;
+
+  constructor(cppDocumentId: number) {
+    this._cppDocumentId = cppDocumentId;
+
+    _cppLocApi.sedRunSchedulerCreate(this._cppDocumentId, (generation: number, instanceId: number) => {
+      if (generation === this._generation) {
+        this._settle(new SedInstance(this._cppDocumentId, {} as IWasmSedDocument, instanceId));
+      }
+    });
+  }
+
+  private _settle(instance: SedInstance | null): void {
+    const resolve = this._resolve;
+
+    this._resolve = null;
+
+    resolve?.(instance);
+  }
+
+  requestRun(changes: ISedModelChange[]): Promise<SedInstance | null> {
+    // Let the previous request, if any, know that it has been superseded.
+
+    this._settle(null);
+
+    return new Promise<SedInstance | null>((resolve) => {
+      this._resolve = resolve;
+
+      _cppLocApi.sedRunSchedulerRequestRun(this._cppDocumentId, ++this._generation, changes);
+    });
+  }
+
+  release(): void {
+    this._settle(null);
+
+    _cppLocApi.sedRunSchedulerRelease(this._cppDocumentId);
+  }
 }
 
 export class SedInstanceTask extends SedIndex {
@@ -459,6 +727,13 @@ export class SedInstanceTask extends SedIndex {
     }
   }
 
+  resultsAvailable(): boolean {
+    // Note: results may only get evicted with the C++ version of libOpenCOR, in which case they need to be reloaded
+    //       (see SedInstance.reloadResults()) or the simulation needs to be run again to get them back.
+
+    return cppVersion() ? _cppLocApi.sedInstanceTaskResultsAvailable(this._cppInstanceId, this._index) : true;
+  }
+
   voiName(): string {
     return cppVersion()
       ? _cppLocApi.sedInstanceTaskVoiName(this._cppInstanceId, this._index)
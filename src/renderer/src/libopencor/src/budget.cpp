@@ -0,0 +1,758 @@
+#include "budget.h"
+#include "common.h"
+#include "compression.h"
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <random>
+#include <thread>
+
+namespace {
+
+constexpr char MAGIC[] = {'O', 'C', 'S', 'R'};
+constexpr const char *EXTENSION = ".spill";
+
+// Our memory accounting is process-wide, i.e. our budget covers the results of the instances of all our environments.
+// Note: the instances of an environment may only be released on the JavaScript thread of that environment, so each
+//       environment has an evictor, i.e. a thread-safe function through which other environments can ask it to evict
+//       some of its instances. An instance that is being evicted doesn't count towards our budget anymore.
+
+struct SedInstanceUsage
+{
+    uint64_t bytes {0};
+    uint64_t lastUsed {0};
+    bool evicting {false};
+    bool evicted {false};
+    std::optional<uint64_t> spilledBytes;
+};
+
+using SedInstanceKey = std::pair<const EnvData *, size_t>;
+
+std::mutex mutex;
+uint64_t budget {0};
+bool spillToDisk {false};
+uint64_t usageClock {0};
+std::map<SedInstanceKey, SedInstanceUsage> usages;
+std::map<const EnvData *, Napi::ThreadSafeFunction> evictors;
+
+uint64_t resultsBytes(const SedInstanceResults &pResults)
+{
+    uint64_t res {0};
+
+    for (const auto &taskResults : pResults) {
+        res += taskResults.voi.size();
+
+        for (const auto *doublesList : {&taskResults.states, &taskResults.rates, &taskResults.constants,
+                                        &taskResults.computedConstants, &taskResults.algebraicVariables}) {
+            for (const auto &doubles : *doublesList) {
+                res += doubles.size();
+            }
+        }
+    }
+
+    return res * sizeof(double);
+}
+
+uint64_t resultsBytes(const libOpenCOR::SedInstancePtr &pSedInstance)
+{
+    // Note: all the results of a task have as many values as its VOI.
+
+    uint64_t res {0};
+
+    for (size_t i = 0; i < pSedInstance->taskCount(); ++i) {
+        auto task = pSedInstance->task(i);
+
+        res += task->voi().size()
+               * (1 + task->stateCount() + task->rateCount() + task->constantCount() + task->computedConstantCount()
+                  + task->algebraicVariableCount());
+    }
+
+    return res * sizeof(double);
+}
+
+std::filesystem::path spillPath(size_t pId)
+{
+    // Note: our instance IDs are only unique within our process, hence our spill files also get a per-process token.
+
+    static const auto token = std::to_string(std::random_device()());
+    std::error_code errorCode;
+    auto directory = std::filesystem::temp_directory_path(errorCode);
+
+    if (errorCode) {
+        return {};
+    }
+
+    return directory / ("opencor-" + token + "-" + std::to_string(pId) + EXTENSION);
+}
+
+void writeDoubles(std::ofstream &pFile, const std::vector<double> &pDoubles)
+{
+    auto bytes = compressDoubles(pDoubles);
+    uint64_t count = pDoubles.size();
+    uint64_t size = bytes.size();
+
+    pFile.write(reinterpret_cast<const char *>(&count), sizeof(count));
+    pFile.write(reinterpret_cast<const char *>(&size), sizeof(size));
+    pFile.write(reinterpret_cast<const char *>(bytes.data()), static_cast<std::streamsize>(size));
+}
+
+void writeDoublesList(std::ofstream &pFile, const std::vector<std::vector<double>> &pDoublesList)
+{
+    uint64_t size = pDoublesList.size();
+
+    pFile.write(reinterpret_cast<const char *>(&size), sizeof(size));
+
+    for (const auto &doubles : pDoublesList) {
+        writeDoubles(pFile, doubles);
+    }
+}
+
+bool readDoubles(std::ifstream &pFile, uint64_t pFileSize, std::vector<double> &pDoubles)
+{
+    // Note: each value takes at least one byte once compressed.
+
+    uint64_t count {0};
+    uint64_t size {0};
+
+    if (!pFile.read(reinterpret_cast<char *>(&count), sizeof(count))
+        || !pFile.read(reinterpret_cast<char *>(&size), sizeof(size))
+        || (size > pFileSize) || (count > size)) {
+        return false;
+    }
+
+    std::vector<uint8_t> bytes(size);
+
+    return pFile.read(reinterpret_cast<char *>(bytes.data()), static_cast<std::streamsize>(size))
+           && decompressDoubles(bytes, count, pDoubles);
+}
+
+bool readDoublesList(std::ifstream &pFile, uint64_t pFileSize, std::vector<std::vector<double>> &pDoublesList)
+{
+    uint64_t size {0};
+
+    if (!pFile.read(reinterpret_cast<char *>(&size), sizeof(size)) || (size > pFileSize / sizeof(uint64_t))) {
+        return false;
+    }
+
+    pDoublesList.resize(size);
+
+    for (auto &doubles : pDoublesList) {
+        if (!readDoubles(pFile, pFileSize, doubles)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+std::filesystem::path writeSpillFile(size_t pId, const SedInstanceResults &pResults)
+{
+    // Write the given results, compressed, to a temporary file.
+
+    auto path = spillPath(pId);
+
+    if (path.empty()) {
+        return {};
+    }
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    uint64_t taskCount = pResults.size();
+
+    file.write(MAGIC, sizeof(MAGIC));
+    file.write(reinterpret_cast<const char *>(&taskCount), sizeof(taskCount));
+
+    for (const auto &taskResults : pResults) {
+        writeDoubles(file, taskResults.voi);
+        writeDoublesList(file, taskResults.states);
+        writeDoublesList(file, taskResults.rates);
+        writeDoublesList(file, taskResults.constants);
+        writeDoublesList(file, taskResults.computedConstants);
+        writeDoublesList(file, taskResults.algebraicVariables);
+    }
+
+    if (!file) {
+        std::error_code errorCode;
+
+        file.close();
+
+        std::filesystem::remove(path, errorCode);
+
+        return {};
+    }
+
+    return path;
+}
+
+SedInstanceResultsPtr unspill(const std::filesystem::path &pPath)
+{
+    std::ifstream file(pPath, std::ios::binary);
+
+    if (!file) {
+        return nullptr;
+    }
+
+    std::error_code errorCode;
+    uint64_t fileSize = std::filesystem::file_size(pPath, errorCode);
+    char magic[sizeof(MAGIC)];
+    uint64_t taskCount {0};
+    auto res = std::make_shared<SedInstanceResults>();
+
+    if (!file.read(magic, sizeof(magic)) || !std::equal(std::begin(magic), std::end(magic), std::begin(MAGIC))
+        || !file.read(reinterpret_cast<char *>(&taskCount), sizeof(taskCount))
+        || (taskCount > fileSize / sizeof(uint64_t))) {
+        return nullptr;
+    }
+
+    res->resize(taskCount);
+
+    for (auto &taskResults : *res) {
+        if (!readDoubles(file, fileSize, taskResults.voi)
+            || !readDoublesList(file, fileSize, taskResults.states)
+            || !readDoublesList(file, fileSize, taskResults.rates)
+            || !readDoublesList(file, fileSize, taskResults.constants)
+            || !readDoublesList(file, fileSize, taskResults.computedConstants)
+            || !readDoublesList(file, fileSize, taskResults.algebraicVariables)) {
+            return nullptr;
+        }
+    }
+
+    return res;
+}
+
+std::shared_future<std::filesystem::path> spill(const EnvData &pData, size_t pId, const SedInstanceResultsPtr &pResults,
+                                                const libOpenCOR::SedInstancePtr &pSedInstance)
+{
+    // Spill the given results (or those of the given instance, which has been released by its environment) to disk in
+    // a background thread, so as not to block JavaScript.
+
+    SedInstanceKey key {&pData, pId};
+
+    auto res = std::async(std::launch::async, [key, pResults, pSedInstance]() {
+        auto results = (pResults != nullptr) ? pResults : sedInstanceResults(pSedInstance);
+        auto path = writeSpillFile(key.second, *results);
+
+        if (!path.empty()) {
+            std::error_code errorCode;
+            auto size = std::filesystem::file_size(path, errorCode);
+            std::lock_guard<std::mutex> lock(mutex);
+            auto usage = usages.find(key);
+
+            if (usage != usages.end()) {
+                usage->second.spilledBytes = errorCode ? 0 : size;
+            }
+        }
+
+        return path;
+    });
+
+    return res.share();
+}
+
+void evict(EnvData &pData, size_t pId)
+{
+    // Release the libOpenCOR instance, if any, and the results we may hold for it, keeping track of the names and
+    // units of its variables, and spilling its results to disk if requested and not already done.
+    // Note: this must be called on the JavaScript thread of the given environment.
+
+    auto &memory = pData.sedInstanceMemory[pId];
+    auto sedInstance = pData.sedInstances.find(pId);
+    auto cachedResults = pData.sedInstanceCachedResults.find(pId);
+    bool spillResults {false};
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        spillResults = spillToDisk;
+    }
+
+    if (spillResults && !memory.spill.valid()) {
+        if (cachedResults != pData.sedInstanceCachedResults.end()) {
+            memory.spill = spill(pData, pId, cachedResults->second, nullptr);
+        } else if (sedInstance != pData.sedInstances.end()) {
+            memory.spill = spill(pData, pId, nullptr, sedInstance->second);
+        }
+    }
+
+    if (sedInstance != pData.sedInstances.end()) {
+        memory.taskInfos = sedInstanceTaskInfos(sedInstance->second);
+
+        pData.sedInstances.erase(sedInstance);
+    }
+
+    if (cachedResults != pData.sedInstanceCachedResults.end()) {
+        pData.sedInstanceCachedResults.erase(cachedResults);
+    }
+
+    pData.sedInstanceCacheKeys.erase(pId);
+    pData.sedInstancesToCache.erase(pId);
+
+    memory.bytes = 0;
+    memory.evicted = true;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto &usage = usages[{&pData, pId}];
+
+    usage.bytes = 0;
+    usage.evicting = false;
+    usage.evicted = true;
+}
+
+void enforceBudget(EnvData &pData, size_t pExceptId)
+{
+    // Evict the least recently used results, whichever their environment, until we are within our budget, if any.
+    // Note: the results that were just used are never evicted, even if they alone exceed our budget. The results of
+    //       another environment get evicted by that environment, through its evictor.
+
+    std::vector<size_t> ids;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::vector<std::map<SedInstanceKey, SedInstanceUsage>::iterator> unevictables;
+
+        if (budget == 0) {
+            return;
+        }
+
+        uint64_t totalBytes {0};
+
+        for (const auto &usage : usages) {
+            if (!usage.second.evicting) {
+                totalBytes += usage.second.bytes;
+            }
+        }
+
+        while (totalBytes > budget) {
+            auto leastRecentlyUsed = usages.end();
+
+            for (auto usage = usages.begin(); usage != usages.end(); ++usage) {
+                if ((usage->second.bytes != 0) && !usage->second.evicting
+                    && (usage->first != SedInstanceKey {&pData, pExceptId})
+                    && ((leastRecentlyUsed == usages.end())
+                        || (usage->second.lastUsed < leastRecentlyUsed->second.lastUsed))) {
+                    leastRecentlyUsed = usage;
+                }
+            }
+
+            if (leastRecentlyUsed == usages.end()) {
+                break;
+            }
+
+            leastRecentlyUsed->second.evicting = true;
+
+            totalBytes -= leastRecentlyUsed->second.bytes;
+
+            if (leastRecentlyUsed->first.first == &pData) {
+                ids.push_back(leastRecentlyUsed->first.second);
+            } else {
+                auto evictor = evictors.find(leastRecentlyUsed->first.first);
+                bool evictionRequested {false};
+
+                if (evictor != evictors.end()) {
+                    auto id = new size_t(leastRecentlyUsed->first.second);
+                    auto status = evictor->second.NonBlockingCall(id, [](Napi::Env pEnv, Napi::Function pCallback, size_t *pId) {
+                        (void)pCallback;
+
+                        std::unique_ptr<size_t> id(pId);
+
+                        if (pEnv == nullptr) {
+                            return;
+                        }
+
+                        // Evict the instance unless it has been used since it was deemed to be evicted.
+
+                        auto &data = envData(pEnv);
+                        bool evicting {false};
+
+                        {
+                            std::lock_guard<std::mutex> lock(mutex);
+                            auto usage = usages.find({&data, *id});
+
+                            evicting = (usage != usages.end()) && usage->second.evicting;
+                        }
+
+                        if (evicting) {
+                            evict(data, *id);
+                        }
+                    });
+
+                    if (status == napi_ok) {
+                        evictionRequested = true;
+                    } else {
+                        delete id;
+                    }
+                }
+
+                if (!evictionRequested) {
+                    unevictables.push_back(leastRecentlyUsed);
+                }
+            }
+        }
+
+        // The results that we couldn't ask their environment to evict (e.g. because it is being torn down) still count
+        // towards our budget, and they may be evicted later.
+
+        for (auto &unevictable : unevictables) {
+            unevictable->second.evicting = false;
+        }
+    }
+
+    for (auto id : ids) {
+        evict(pData, id);
+    }
+}
+
+void allocate(EnvData &pData, size_t pId, uint64_t pBytes)
+{
+    // Account for the results of the given instance, which have just been allocated, as the most recently used ones,
+    // and evict other results, if needed.
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto &usage = usages[{&pData, pId}];
+
+        usage.bytes = pBytes;
+        usage.lastUsed = ++usageClock;
+        usage.evicting = false;
+        usage.evicted = false;
+    }
+
+    enforceBudget(pData, pId);
+}
+
+// A worker to reload spilled results from disk without blocking JavaScript.
+// Note: we may have to wait for our results to be spilled, if they were evicted very recently.
+
+class SedInstanceReloadWorker : public Napi::AsyncWorker
+{
+public:
+    explicit SedInstanceReloadWorker(const Napi::Env &pEnv, size_t pId,
+                                     const std::shared_future<std::filesystem::path> &pSpill);
+
+    Napi::Promise promise() const;
+
+    void Execute() override;
+    void OnOK() override;
+    void OnError(const Napi::Error &pError) override;
+
+private:
+    Napi::Promise::Deferred mDeferred;
+    size_t mId;
+    std::shared_future<std::filesystem::path> mSpill;
+
+    std::filesystem::path mPath;
+    SedInstanceResultsPtr mResults;
+};
+
+SedInstanceReloadWorker::SedInstanceReloadWorker(const Napi::Env &pEnv, size_t pId,
+                                                 const std::shared_future<std::filesystem::path> &pSpill)
+    : Napi::AsyncWorker(pEnv)
+    , mDeferred(Napi::Promise::Deferred::New(pEnv))
+    , mId(pId)
+    , mSpill(pSpill)
+{
+}
+
+Napi::Promise SedInstanceReloadWorker::promise() const
+{
+    return mDeferred.Promise();
+}
+
+void SedInstanceReloadWorker::Execute()
+{
+    mPath = mSpill.get();
+    mResults = mPath.empty() ? nullptr : unspill(mPath);
+}
+
+void SedInstanceReloadWorker::OnOK()
+{
+    // Use our reloaded results, unless the instance has been released or its results have already been reloaded in the
+    // meantime. If our results couldn't be reloaded, then forget about their spill file.
+
+    auto env = Env();
+    auto &data = envData(env);
+    auto memory = data.sedInstanceMemory.find(mId);
+
+    if ((memory == data.sedInstanceMemory.end()) || !memory->second.evicted) {
+        mDeferred.Resolve(Napi::Boolean::New(env, memory != data.sedInstanceMemory.end()));
+
+        return;
+    }
+
+    if (mResults == nullptr) {
+        std::error_code errorCode;
+
+        if (!mPath.empty()) {
+            std::filesystem::remove(mPath, errorCode);
+        }
+
+        memory->second.spill = {};
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto usage = usages.find({&data, mId});
+
+            if (usage != usages.end()) {
+                usage->second.spilledBytes.reset();
+            }
+        }
+
+        mDeferred.Resolve(Napi::Boolean::New(env, false));
+
+        return;
+    }
+
+    data.sedInstanceCachedResults[mId] = mResults;
+
+    memory->second.bytes = resultsBytes(*mResults);
+    memory->second.evicted = false;
+
+    allocate(data, mId, *memory->second.bytes);
+
+    mDeferred.Resolve(Napi::Boolean::New(env, true));
+}
+
+void SedInstanceReloadWorker::OnError(const Napi::Error &pError)
+{
+    mDeferred.Reject(pError.Value());
+}
+
+void evictorFunction(const Napi::CallbackInfo &pInfo)
+{
+    // Note: our evictor does all its work in its call callback, so there is nothing for its JavaScript function to do.
+
+    (void)pInfo;
+}
+
+} // namespace
+
+void initMemoryAccounting(const Napi::Env &pEnv)
+{
+    // Create the evictor of the given environment.
+    // Note: our evictor must not keep the event loop alive.
+
+    auto evictor = Napi::ThreadSafeFunction::New(pEnv, Napi::Function::New(pEnv, evictorFunction), "MemoryEvictor", 0, 1);
+
+    evictor.Unref(pEnv);
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    evictors[&envData(pEnv)] = evictor;
+}
+
+void cleanUpMemoryAccounting(EnvData &pData)
+{
+    // Forget about the instances and the evictor of the given environment, and remove its spill files, waiting for
+    // them to be written, if needed.
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto evictor = evictors.find(&pData);
+
+        if (evictor != evictors.end()) {
+            evictor->second.Release();
+
+            evictors.erase(evictor);
+        }
+
+        std::erase_if(usages, [&pData](const auto &pUsage) {
+            return pUsage.first.first == &pData;
+        });
+    }
+
+    std::error_code errorCode;
+
+    for (auto &memory : pData.sedInstanceMemory) {
+        if (memory.second.spill.valid()) {
+            auto path = memory.second.spill.get();
+
+            if (!path.empty()) {
+                std::filesystem::remove(path, errorCode);
+            }
+        }
+    }
+
+    pData.sedInstanceMemory.clear();
+}
+
+void sedInstanceTouch(const Napi::Env &pEnv, size_t pId)
+{
+    // Mark the results of the given instance as the most recently used ones and, if we haven't already done so, account
+    // for them, which is when the results of other instances may get evicted.
+    // Note: evicted results are not available until they get reloaded (see sedInstanceReloadResults()).
+
+    auto &data = envData(pEnv);
+    auto memory = data.sedInstanceMemory.find(pId);
+
+    if ((memory != data.sedInstanceMemory.end()) && memory->second.evicted) {
+        return;
+    }
+
+    if ((memory != data.sedInstanceMemory.end()) && memory->second.bytes.has_value()) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto usage = usages.find({&data, pId});
+
+        if (usage != usages.end()) {
+            usage->second.lastUsed = ++usageClock;
+        }
+
+        return;
+    }
+
+    auto cachedResults = data.sedInstanceCachedResults.find(pId);
+    auto sedInstance = data.sedInstances.find(pId);
+    uint64_t bytes {0};
+
+    if (cachedResults != data.sedInstanceCachedResults.end()) {
+        bytes = resultsBytes(*cachedResults->second);
+    } else if ((sedInstance != data.sedInstances.end()) && (static_cast<int>(sedInstance->second->status()) == 0)) {
+        bytes = resultsBytes(sedInstance->second);
+    } else {
+        return;
+    }
+
+    data.sedInstanceMemory[pId].bytes = bytes;
+
+    allocate(data, pId, bytes);
+}
+
+void sedInstanceResetMemory(const Napi::Env &pEnv, size_t pId)
+{
+    // The instance is about to be (re)run, so its current results are about to be replaced.
+
+    auto &data = envData(pEnv);
+
+    data.sedInstanceMemory[pId].bytes.reset();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto usage = usages.find({&data, pId});
+
+    if (usage != usages.end()) {
+        usage->second.bytes = 0;
+    }
+}
+
+void sedInstanceRelease(EnvData &pData, size_t pId)
+{
+    // Release the given instance and its results, wherever they are, since they are not needed anymore.
+    // Note: its results may still be being spilled to disk, in which case we remove their spill file once it has been
+    //       written, without blocking JavaScript.
+
+    auto memory = pData.sedInstanceMemory.find(pId);
+
+    if (memory != pData.sedInstanceMemory.end()) {
+        if (memory->second.spill.valid()) {
+            std::thread([spill = memory->second.spill]() {
+                auto path = spill.get();
+
+                if (!path.empty()) {
+                    std::error_code errorCode;
+
+                    std::filesystem::remove(path, errorCode);
+                }
+            }).detach();
+        }
+
+        pData.sedInstanceMemory.erase(memory);
+    }
+
+    pData.sedInstances.erase(pId);
+    pData.sedInstanceCachedResults.erase(pId);
+    pData.sedInstanceCacheKeys.erase(pId);
+    pData.sedInstancesToCache.erase(pId);
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    usages.erase({&pData, pId});
+}
+
+// SedInstance API.
+
+napi_value sedInstanceReloadResults(const Napi::CallbackInfo &pInfo)
+{
+    // Reload the results of the given instance from disk, if they were evicted and spilled, and return a promise that
+    // resolves to whether its results are available.
+    // Note: Node-API deletes our worker once it has completed.
+
+    auto env = pInfo.Env();
+    auto id = toSizeT(pInfo[0]);
+    auto &sedInstanceMemory = envData(env).sedInstanceMemory;
+    auto memory = sedInstanceMemory.find(id);
+
+    if ((memory == sedInstanceMemory.end()) || !memory->second.evicted || !memory->second.spill.valid()) {
+        auto deferred = Napi::Promise::Deferred::New(env);
+
+        deferred.Resolve(Napi::Boolean::New(env, (memory == sedInstanceMemory.end()) || !memory->second.evicted));
+
+        return deferred.Promise();
+    }
+
+    auto worker = new SedInstanceReloadWorker(env, id, memory->second.spill);
+    auto res = worker->promise();
+
+    worker->Queue();
+
+    return res;
+}
+
+// Memory API.
+
+void memorySetBudget(const Napi::CallbackInfo &pInfo)
+{
+    // Set the maximum number of bytes that the results of our instances, across all our environments, may use (zero
+    // meaning no limit) and whether evicted results should be spilled to disk rather than dropped.
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        budget = static_cast<uint64_t>(toDouble(pInfo[0]));
+        spillToDisk = pInfo[1].As<Napi::Boolean>().Value();
+    }
+
+    enforceBudget(envData(pInfo.Env()), std::numeric_limits<size_t>::max());
+}
+
+napi_value memoryUsage(const Napi::CallbackInfo &pInfo)
+{
+    auto env = pInfo.Env();
+    auto res = Napi::Object::New(env);
+    uint64_t memoryBudget {0};
+    uint64_t totalBytes {0};
+    uint64_t residentCount {0};
+    uint64_t evictedCount {0};
+    uint64_t spilledCount {0};
+    uint64_t spilledBytes {0};
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        memoryBudget = budget;
+
+        for (const auto &usage : usages) {
+            if (usage.second.evicted) {
+                ++evictedCount;
+            } else if (usage.second.bytes != 0) {
+                ++residentCount;
+
+                totalBytes += usage.second.bytes;
+            }
+
+            if (usage.second.spilledBytes.has_value()) {
+                ++spilledCount;
+
+                spilledBytes += *usage.second.spilledBytes;
+            }
+        }
+    }
+
+    res.Set("budget", Napi::Number::New(env, static_cast<double>(memoryBudget)));
+    res.Set("totalBytes", Napi::Number::New(env, static_cast<double>(totalBytes)));
+    res.Set("residentCount", Napi::Number::New(env, static_cast<double>(residentCount)));
+    res.Set("evictedCount", Napi::Number::New(env, static_cast<double>(evictedCount)));
+    res.Set("spilledCount", Napi::Number::New(env, static_cast<double>(spilledCount)));
+    res.Set("spilledBytes", Napi::Number::New(env, static_cast<double>(spilledBytes)));
+
+    return res;
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <future>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <napi.h>
+
+#include "cache.h"
+
+struct EnvData;
+
+// The memory used by the results of a SED-ML instance, as seen from its environment.
+// Note: bytes is only known once the instance has been run (or its results have been retrieved from our results cache
+//       or from disk). An evicted instance has had its libOpenCOR instance released, and its results may have been
+//       spilled to disk, in which case spill gives the path of the spill file once it has been written (or an empty
+//       path if it couldn't be written). An instance without a libOpenCOR instance (i.e. an evicted instance or an
+//       instance which results come from our results cache) has taskInfos keep track of the names and units of its
+//       variables.
+
+struct SedInstanceMemory
+{
+    std::optional<uint64_t> bytes;
+    bool evicted {false};
+    std::shared_future<std::filesystem::path> spill;
+    SedInstanceTaskInfos taskInfos;
+};
+
+void initMemoryAccounting(const Napi::Env &pEnv);
+void cleanUpMemoryAccounting(EnvData &pData);
+void sedInstanceTouch(const Napi::Env &pEnv, size_t pId);
+void sedInstanceResetMemory(const Napi::Env &pEnv, size_t pId);
+void sedInstanceRelease(EnvData &pData, size_t pId);
+
+// SedInstance API.
+
+napi_value sedInstanceReloadResults(const Napi::CallbackInfo &pInfo);
+
+// Memory API.
+
+void memorySetBudget(const Napi::CallbackInfo &pInfo);
+napi_value memoryUsage(const Napi::CallbackInfo &pInfo);
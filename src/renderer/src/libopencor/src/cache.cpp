@@ -0,0 +1,991 @@
+#include "cache.h"
+#include "common.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <mutex>
+#include <set>
+#include <string_view>
+
+namespace {
+
+constexpr char MAGIC[] = {'O', 'C', 'M', 'C'};
+constexpr uint32_t FORMAT_VERSION = 2;
+constexpr const char *EXTENSION = ".results";
+
+// Note: mutex protects our configuration while evictionMutex serialises the scanning and removal of our entries, so
+//       that neither looking up nor writing an entry has to wait for an eviction to complete.
+
+std::mutex mutex;
+std::filesystem::path directory;
+uint64_t maximumSize {0};
+std::mutex evictionMutex;
+std::mutex writersMutex;
+std::vector<std::future<void>> writers;
+std::atomic<uint64_t> writerId {0};
+std::atomic<uint64_t> hits {0};
+std::atomic<uint64_t> misses {0};
+std::atomic<uint64_t> evictions {0};
+
+uint64_t fnv1a(uint64_t pHash, const void *pData, size_t pSize)
+{
+    auto data = static_cast<const unsigned char *>(pData);
+
+    for (size_t i = 0; i < pSize; ++i) {
+        pHash ^= data[i];
+        pHash *= 0x100000001b3ULL;
+    }
+
+    return pHash;
+}
+
+std::string cpuFeatures()
+{
+    std::string res;
+
+#if defined(__x86_64__) || defined(_M_X64)
+    res = "x64";
+
+#    if defined(__GNUC__) || defined(__clang__)
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx")) {
+        res += "+avx";
+    }
+
+    if (__builtin_cpu_supports("avx2")) {
+        res += "+avx2";
+    }
+
+    if (__builtin_cpu_supports("fma")) {
+        res += "+fma";
+    }
+
+    if (__builtin_cpu_supports("avx512f")) {
+        res += "+avx512f";
+    }
+#    endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    res = "arm64";
+#else
+    res = "unknown";
+#endif
+
+    return res;
+}
+
+std::filesystem::path cacheDirectory(uint64_t *pMaximumSize = nullptr)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (pMaximumSize != nullptr) {
+        *pMaximumSize = maximumSize;
+    }
+
+    return directory;
+}
+
+void appendMaterial(std::string &pMaterial, std::string_view pData)
+{
+    // Note: each piece of material is prefixed with its size, so that different pieces cannot add up to the same
+    //       material.
+
+    uint64_t size = pData.size();
+
+    pMaterial.append(reinterpret_cast<const char *>(&size), sizeof(size));
+    pMaterial.append(pData);
+}
+
+void writeString(std::ofstream &pFile, const std::string &pString)
+{
+    uint64_t size = pString.size();
+
+    pFile.write(reinterpret_cast<const char *>(&size), sizeof(size));
+    pFile.write(pString.data(), static_cast<std::streamsize>(size));
+}
+
+void writeStrings(std::ofstream &pFile, const std::vector<std::string> &pStrings)
+{
+    uint64_t size = pStrings.size();
+
+    pFile.write(reinterpret_cast<const char *>(&size), sizeof(size));
+
+    for (const auto &string : pStrings) {
+        writeString(pFile, string);
+    }
+}
+
+void writeDoubles(std::ofstream &pFile, const std::vector<double> &pDoubles)
+{
+    uint64_t size = pDoubles.size();
+
+    pFile.write(reinterpret_cast<const char *>(&size), sizeof(size));
+    pFile.write(reinterpret_cast<const char *>(pDoubles.data()), static_cast<std::streamsize>(size * sizeof(double)));
+}
+
+void writeDoublesList(std::ofstream &pFile, const std::vector<std::vector<double>> &pDoublesList)
+{
+    uint64_t size = pDoublesList.size();
+
+    pFile.write(reinterpret_cast<const char *>(&size), sizeof(size));
+
+    for (const auto &doubles : pDoublesList) {
+        writeDoubles(pFile, doubles);
+    }
+}
+
+bool readString(std::ifstream &pFile, uint64_t pFileSize, std::string &pString)
+{
+    uint64_t size {0};
+
+    if (!pFile.read(reinterpret_cast<char *>(&size), sizeof(size)) || (size > pFileSize)) {
+        return false;
+    }
+
+    pString.resize(size);
+
+    return static_cast<bool>(pFile.read(pString.data(), static_cast<std::streamsize>(size)));
+}
+
+bool readStrings(std::ifstream &pFile, uint64_t pFileSize, std::vector<std::string> &pStrings)
+{
+    uint64_t size {0};
+
+    if (!pFile.read(reinterpret_cast<char *>(&size), sizeof(size)) || (size > pFileSize / sizeof(uint64_t))) {
+        return false;
+    }
+
+    pStrings.resize(size);
+
+    for (auto &string : pStrings) {
+        if (!readString(pFile, pFileSize, string)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool readDoubles(std::ifstream &pFile, uint64_t pFileSize, std::vector<double> &pDoubles)
+{
+    uint64_t size {0};
+
+    if (!pFile.read(reinterpret_cast<char *>(&size), sizeof(size)) || (size > pFileSize / sizeof(double))) {
+        return false;
+    }
+
+    pDoubles.resize(size);
+
+    return static_cast<bool>(pFile.read(reinterpret_cast<char *>(pDoubles.data()), static_cast<std::streamsize>(size * sizeof(double))));
+}
+
+bool readDoublesList(std::ifstream &pFile, uint64_t pFileSize, std::vector<std::vector<double>> &pDoublesList)
+{
+    uint64_t size {0};
+
+    if (!pFile.read(reinterpret_cast<char *>(&size), sizeof(size)) || (size > pFileSize / sizeof(uint64_t))) {
+        return false;
+    }
+
+    pDoublesList.resize(size);
+
+    for (auto &doubles : pDoublesList) {
+        if (!readDoubles(pFile, pFileSize, doubles)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void evict(const std::filesystem::path &pDirectory, uint64_t pMaximumSize)
+{
+    // Remove the least recently used entries until our cache fits within its maximum size.
+    // Note: this must be called with our eviction mutex locked.
+
+    std::vector<std::filesystem::directory_entry> entries;
+    uint64_t size {0};
+    std::error_code errorCode;
+
+    for (const auto &entry : std::filesystem::directory_iterator(pDirectory, errorCode)) {
+        if (entry.is_regular_file(errorCode) && (entry.path().extension() == EXTENSION)) {
+            entries.push_back(entry);
+
+            size += entry.file_size(errorCode);
+        }
+    }
+
+    if (size <= pMaximumSize) {
+        return;
+    }
+
+    std::sort(entries.begin(), entries.end(), [](const auto &pEntry1, const auto &pEntry2) {
+        std::error_code errorCode;
+
+        return pEntry1.last_write_time(errorCode) < pEntry2.last_write_time(errorCode);
+    });
+
+    for (const auto &entry : entries) {
+        if (size <= pMaximumSize) {
+            break;
+        }
+
+        auto entrySize = entry.file_size(errorCode);
+
+        if (std::filesystem::remove(entry.path(), errorCode)) {
+            size -= entrySize;
+
+            ++evictions;
+        }
+    }
+}
+
+std::filesystem::path toPath(const std::string &pPath)
+{
+    return std::filesystem::path(std::u8string(pPath.begin(), pPath.end()));
+}
+
+std::string fromPath(const std::filesystem::path &pPath)
+{
+    auto res = pPath.u8string();
+
+    return std::string(res.begin(), res.end());
+}
+
+bool isXmlSpace(char pChar)
+{
+    return (pChar == ' ') || (pChar == '\t') || (pChar == '\r') || (pChar == '\n');
+}
+
+std::string_view xmlLocalName(std::string_view pName)
+{
+    auto colon = pName.find(':');
+
+    return (colon != std::string_view::npos) ? pName.substr(colon + 1) : pName;
+}
+
+std::optional<std::string> xmlAttributeValue(std::string_view pValue)
+{
+    // Return the given attribute value with its character and entity references replaced, or nothing if one of them is
+    // not valid.
+
+    std::string res;
+    size_t position {0};
+
+    while (position < pValue.size()) {
+        if (pValue[position] != '&') {
+            res += pValue[position++];
+
+            continue;
+        }
+
+        auto end = pValue.find(';', position);
+
+        if (end == std::string_view::npos) {
+            return std::nullopt;
+        }
+
+        auto reference = pValue.substr(position + 1, end - position - 1);
+
+        position = end + 1;
+
+        if (reference == "amp") {
+            res += '&';
+        } else if (reference == "lt") {
+            res += '<';
+        } else if (reference == "gt") {
+            res += '>';
+        } else if (reference == "quot") {
+            res += '"';
+        } else if (reference == "apos") {
+            res += '\'';
+        } else if (reference.starts_with('#')) {
+            auto hexadecimal = reference.starts_with("#x");
+            auto digits = reference.substr(hexadecimal ? 2 : 1);
+            uint32_t codePoint {0};
+
+            if (digits.empty() || (digits.size() > 8)) {
+                return std::nullopt;
+            }
+
+            for (auto digit : digits) {
+                auto lowerDigit = static_cast<char>(digit | 0x20);
+                int value {};
+
+                if ((digit >= '0') && (digit <= '9')) {
+                    value = digit - '0';
+                } else if (hexadecimal && (lowerDigit >= 'a') && (lowerDigit <= 'f')) {
+                    value = lowerDigit - 'a' + 10;
+                } else {
+                    return std::nullopt;
+                }
+
+                codePoint = codePoint * (hexadecimal ? 16 : 10) + static_cast<uint32_t>(value);
+            }
+
+            if (codePoint > 0x10ffff) {
+                return std::nullopt;
+            }
+
+            // Encode the code point as UTF-8.
+
+            if (codePoint < 0x80) {
+                res += static_cast<char>(codePoint);
+            } else if (codePoint < 0x800) {
+                res += static_cast<char>(0xc0 | (codePoint >> 6));
+                res += static_cast<char>(0x80 | (codePoint & 0x3f));
+            } else if (codePoint < 0x10000) {
+                res += static_cast<char>(0xe0 | (codePoint >> 12));
+                res += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f));
+                res += static_cast<char>(0x80 | (codePoint & 0x3f));
+            } else {
+                res += static_cast<char>(0xf0 | (codePoint >> 18));
+                res += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3f));
+                res += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f));
+                res += static_cast<char>(0x80 | (codePoint & 0x3f));
+            }
+        } else {
+            return std::nullopt;
+        }
+    }
+
+    return res;
+}
+
+std::optional<std::vector<std::string>> cellmlImportHrefs(const std::string &pContents)
+{
+    // Return the href attribute of the import elements of the given CellML contents, or nothing if the contents are not
+    // well-formed enough for us to tell.
+    // Note: we only have access to libOpenCOR's API, which doesn't expose the imports of a model, so we parse the
+    //       markup ourselves. We skip comments, CDATA sections, processing instructions, document type declarations,
+    //       and end tags, and we parse the attributes of start tags the way XML does, i.e. with optional whitespace
+    //       around the equal sign, single or double quotes, and character and entity references. We match import
+    //       elements and href attributes on their local name, whatever their namespace prefix (e.g. xlink:href).
+
+    std::vector<std::string> res;
+    std::string_view contents(pContents);
+    size_t position {0};
+
+    while ((position = contents.find('<', position)) != std::string_view::npos) {
+        auto markup = contents.substr(position);
+        std::string_view terminator;
+
+        if (markup.starts_with("<!--")) {
+            terminator = "-->";
+        } else if (markup.starts_with("<![CDATA[")) {
+            terminator = "]]>";
+        } else if (markup.starts_with("<?")) {
+            terminator = "?>";
+        } else if (markup.starts_with("</")) {
+            terminator = ">";
+        }
+
+        if (!terminator.empty()) {
+            auto end = contents.find(terminator, position + 2);
+
+            if (end == std::string_view::npos) {
+                return std::nullopt;
+            }
+
+            position = end + terminator.size();
+
+            continue;
+        }
+
+        if (markup.starts_with("<!")) {
+            // A document type declaration, which may have an internal subset.
+
+            size_t depth {0};
+
+            for (++position; position < contents.size(); ++position) {
+                if (contents[position] == '[') {
+                    ++depth;
+                } else if ((contents[position] == ']') && (depth > 0)) {
+                    --depth;
+                } else if ((contents[position] == '>') && (depth == 0)) {
+                    break;
+                }
+            }
+
+            if (position == contents.size()) {
+                return std::nullopt;
+            }
+
+            ++position;
+
+            continue;
+        }
+
+        // A start tag, so retrieve its name and attributes.
+
+        auto nameStart = ++position;
+
+        while ((position < contents.size()) && !isXmlSpace(contents[position]) && (contents[position] != '/')
+               && (contents[position] != '>')) {
+            ++position;
+        }
+
+        auto isImport = xmlLocalName(contents.substr(nameStart, position - nameStart)) == "import";
+        std::optional<std::string> href;
+
+        for (;;) {
+            while ((position < contents.size()) && isXmlSpace(contents[position])) {
+                ++position;
+            }
+
+            if (position == contents.size()) {
+                return std::nullopt;
+            }
+
+            if ((contents[position] == '>') || contents.substr(position).starts_with("/>")) {
+                break;
+            }
+
+            auto attributeNameStart = position;
+
+            while ((position < contents.size()) && !isXmlSpace(contents[position]) && (contents[position] != '=')) {
+                ++position;
+            }
+
+            auto attributeName = contents.substr(attributeNameStart, position - attributeNameStart);
+
+            while ((position < contents.size()) && isXmlSpace(contents[position])) {
+                ++position;
+            }
+
+            if ((position == contents.size()) || (contents[position] != '=')) {
+                return std::nullopt;
+            }
+
+            ++position;
+
+            while ((position < contents.size()) && isXmlSpace(contents[position])) {
+                ++position;
+            }
+
+            if ((position == contents.size()) || ((contents[position] != '"') && (contents[position] != '\''))) {
+                return std::nullopt;
+            }
+
+            auto valueEnd = contents.find(contents[position], position + 1);
+
+            if (valueEnd == std::string_view::npos) {
+                return std::nullopt;
+            }
+
+            auto value = contents.substr(position + 1, valueEnd - position - 1);
+
+            position = valueEnd + 1;
+
+            if (isImport && (xmlLocalName(attributeName) == "href")) {
+                href = xmlAttributeValue(value);
+
+                if (!href.has_value()) {
+                    return std::nullopt;
+                }
+            }
+        }
+
+        if (isImport) {
+            if (!href.has_value()) {
+                return std::nullopt;
+            }
+
+            res.push_back(std::move(*href));
+        }
+    }
+
+    return res;
+}
+
+std::optional<std::string> fileContents(const EnvData &pEnvData, const std::string &pPath)
+{
+    // Return the contents of the given file, preferably from the files that libOpenCOR's file manager manages for our
+    // environment (e.g. the child files of a COMBINE archive), or from disk otherwise.
+
+    auto file = pEnvData.files.find(pPath);
+
+    if (file != pEnvData.files.end()) {
+        auto contents = file->second->contents();
+
+        return std::string(contents.begin(), contents.end());
+    }
+
+    std::ifstream diskFile(toPath(pPath), std::ios::binary);
+
+    if (!diskFile) {
+        return std::nullopt;
+    }
+
+    return std::string(std::istreambuf_iterator<char>(diskFile), std::istreambuf_iterator<char>());
+}
+
+} // namespace
+
+SedInstanceResultsPtr sedInstanceResults(const libOpenCOR::SedInstancePtr &pSedInstance)
+{
+    // Retrieve the results of the given instance.
+
+    auto res = std::make_shared<SedInstanceResults>();
+
+    for (size_t i = 0; i < pSedInstance->taskCount(); ++i) {
+        auto task = pSedInstance->task(i);
+        SedInstanceTaskResults taskResults;
+
+        taskResults.voi = task->voi();
+
+        for (size_t j = 0; j < task->stateCount(); ++j) {
+            taskResults.states.push_back(task->state(j));
+        }
+
+        for (size_t j = 0; j < task->rateCount(); ++j) {
+            taskResults.rates.push_back(task->rate(j));
+        }
+
+        for (size_t j = 0; j < task->constantCount(); ++j) {
+            taskResults.constants.push_back(task->constant(j));
+        }
+
+        for (size_t j = 0; j < task->computedConstantCount(); ++j) {
+            taskResults.computedConstants.push_back(task->computedConstant(j));
+        }
+
+        for (size_t j = 0; j < task->algebraicVariableCount(); ++j) {
+            taskResults.algebraicVariables.push_back(task->algebraicVariable(j));
+        }
+
+        res->push_back(std::move(taskResults));
+    }
+
+    return res;
+}
+
+SedInstanceTaskInfos sedInstanceTaskInfos(const libOpenCOR::SedInstancePtr &pSedInstance)
+{
+    // Retrieve the names and units of the variables of the tasks of the given instance.
+
+    SedInstanceTaskInfos res;
+
+    for (size_t i = 0; i < pSedInstance->taskCount(); ++i) {
+        auto task = pSedInstance->task(i);
+        SedInstanceTaskInfo taskInfo;
+
+        taskInfo.voiName = task->voiName();
+        taskInfo.voiUnit = task->voiUnit();
+
+        for (size_t j = 0; j < task->stateCount(); ++j) {
+            taskInfo.stateNames.push_back(task->stateName(j));
+            taskInfo.stateUnits.push_back(task->stateUnit(j));
+        }
+
+        for (size_t j = 0; j < task->rateCount(); ++j) {
+            taskInfo.rateNames.push_back(task->rateName(j));
+            taskInfo.rateUnits.push_back(task->rateUnit(j));
+        }
+
+        for (size_t j = 0; j < task->constantCount(); ++j) {
+            taskInfo.constantNames.push_back(task->constantName(j));
+            taskInfo.constantUnits.push_back(task->constantUnit(j));
+        }
+
+        for (size_t j = 0; j < task->computedConstantCount(); ++j) {
+            taskInfo.computedConstantNames.push_back(task->computedConstantName(j));
+            taskInfo.computedConstantUnits.push_back(task->computedConstantUnit(j));
+        }
+
+        for (size_t j = 0; j < task->algebraicVariableCount(); ++j) {
+            taskInfo.algebraicVariableNames.push_back(task->algebraicVariableName(j));
+            taskInfo.algebraicVariableUnits.push_back(task->algebraicVariableUnit(j));
+        }
+
+        res.push_back(std::move(taskInfo));
+    }
+
+    return res;
+}
+
+bool resultsCacheEnabled()
+{
+    return !cacheDirectory().empty();
+}
+
+std::optional<std::string> resultsCacheModelFiles(const EnvData &pEnvData, const libOpenCOR::SedDocumentPtr &pSedDocument)
+{
+    // Return the path and contents of the model files of the given SED-ML document, as well as of the files that they
+    // import, directly or not. We return nothing (i.e. our results cache is not to be used) if one of those files
+    // cannot be retrieved (e.g. a remote import), since we would then not be able to tell whether it has changed.
+    // Note: this must be called on the JavaScript thread since we may access the files of our environment.
+
+    if (!resultsCacheEnabled()) {
+        return std::nullopt;
+    }
+
+    std::string res;
+    std::set<std::string> paths;
+    std::vector<std::pair<std::string, std::string>> files;
+
+    for (size_t i = 0; i < pSedDocument->modelCount(); ++i) {
+        auto file = pSedDocument->model(i)->file();
+
+        if (file == nullptr) {
+            return std::nullopt;
+        }
+
+        auto contents = file->contents();
+
+        files.emplace_back(file->path(), std::string(contents.begin(), contents.end()));
+    }
+
+    while (!files.empty()) {
+        auto [path, contents] = std::move(files.back());
+
+        files.pop_back();
+
+        if (!paths.insert(path).second) {
+            continue;
+        }
+
+        appendMaterial(res, path);
+        appendMaterial(res, contents);
+
+        auto hrefs = cellmlImportHrefs(contents);
+
+        if (!hrefs.has_value()) {
+            return std::nullopt;
+        }
+
+        for (const auto &href : *hrefs) {
+            if ((href.find("://") != std::string::npos) || (path.find("://") != std::string::npos)) {
+                return std::nullopt;
+            }
+
+            auto importPath = fromPath((toPath(path).parent_path() / toPath(href)).lexically_normal());
+            auto importContents = fileContents(pEnvData, importPath);
+
+            if (!importContents.has_value()) {
+                return std::nullopt;
+            }
+
+            files.emplace_back(importPath, std::move(*importContents));
+        }
+    }
+
+    return res;
+}
+
+ResultsCacheKey resultsCacheKey(const libOpenCOR::SedDocumentPtr &pSedDocument, const std::string &pModelFiles)
+{
+    if (!resultsCacheEnabled()) {
+        return {};
+    }
+
+    // Our key material consists of the version of libOpenCOR, the features of the CPU, the SED-ML document (which
+    // includes the simulation settings and the changes to the model), and the model files (including the files they
+    // import). Our key name is a hash of it.
+
+    ResultsCacheKey res;
+
+    appendMaterial(res.material, libOpenCOR::versionString());
+    appendMaterial(res.material, cpuFeatures());
+    appendMaterial(res.material, pSedDocument->serialise());
+    appendMaterial(res.material, pModelFiles);
+
+    uint64_t hash = fnv1a(0xcbf29ce484222325ULL, res.material.data(), res.material.size());
+    static constexpr char HEX_DIGITS[] = "0123456789abcdef";
+
+    res.name = std::string(16, '0');
+
+    for (size_t i = 0; i < 16; ++i) {
+        res.name[15 - i] = HEX_DIGITS[(hash >> (4 * i)) & 0xf];
+    }
+
+    return res;
+}
+
+ResultsCacheEntry resultsCacheLoad(const ResultsCacheKey &pKey)
+{
+    auto cacheDir = cacheDirectory();
+
+    if (cacheDir.empty() || pKey.name.empty()) {
+        return {};
+    }
+
+    auto path = cacheDir / (pKey.name + EXTENSION);
+    std::ifstream file(path, std::ios::binary);
+
+    if (!file) {
+        ++misses;
+
+        return {};
+    }
+
+    // Read and check our header (including our key material, since different key materials may have the same name),
+    // and then the names and units of the variables and the results of our tasks.
+    // Note: the sizes we read are checked against the size of the file, so that a corrupted entry cannot get us to
+    //       allocate an unreasonable amount of memory.
+
+    std::error_code errorCode;
+    uint64_t fileSize = std::filesystem::file_size(path, errorCode);
+    char magic[sizeof(MAGIC)];
+    uint32_t formatVersion {0};
+    std::string material;
+    uint64_t taskCount {0};
+    auto results = std::make_shared<SedInstanceResults>();
+    SedInstanceTaskInfos taskInfos;
+    bool valid = file.read(magic, sizeof(magic))
+                 && std::equal(std::begin(magic), std::end(magic), std::begin(MAGIC))
+                 && file.read(reinterpret_cast<char *>(&formatVersion), sizeof(formatVersion))
+                 && (formatVersion == FORMAT_VERSION)
+                 && readString(file, fileSize, material);
+
+    if (valid && (material != pKey.material)) {
+        // The entry is for another key which happens to have the same name.
+
+        ++misses;
+
+        return {};
+    }
+
+    valid = valid
+            && file.read(reinterpret_cast<char *>(&taskCount), sizeof(taskCount))
+            && (taskCount <= fileSize / sizeof(uint64_t));
+
+    if (valid) {
+        results->resize(taskCount);
+        taskInfos.resize(taskCount);
+
+        for (size_t i = 0; valid && (i < taskCount); ++i) {
+            auto &taskInfo = taskInfos[i];
+            auto &taskResults = (*results)[i];
+
+            valid = readString(file, fileSize, taskInfo.voiName)
+                    && readString(file, fileSize, taskInfo.voiUnit)
+                    && readStrings(file, fileSize, taskInfo.stateNames)
+                    && readStrings(file, fileSize, taskInfo.stateUnits)
+                    && readStrings(file, fileSize, taskInfo.rateNames)
+                    && readStrings(file, fileSize, taskInfo.rateUnits)
+                    && readStrings(file, fileSize, taskInfo.constantNames)
+                    && readStrings(file, fileSize, taskInfo.constantUnits)
+                    && readStrings(file, fileSize, taskInfo.computedConstantNames)
+                    && readStrings(file, fileSize, taskInfo.computedConstantUnits)
+                    && readStrings(file, fileSize, taskInfo.algebraicVariableNames)
+                    && readStrings(file, fileSize, taskInfo.algebraicVariableUnits)
+                    && readDoubles(file, fileSize, taskResults.voi)
+                    && readDoublesList(file, fileSize, taskResults.states)
+                    && readDoublesList(file, fileSize, taskResults.rates)
+                    && readDoublesList(file, fileSize, taskResults.constants)
+                    && readDoublesList(file, fileSize, taskResults.computedConstants)
+                    && readDoublesList(file, fileSize, taskResults.algebraicVariables);
+        }
+    }
+
+    file.close();
+
+    if (!valid) {
+        // The entry is corrupted or was created by an older version of OpenCOR, so remove it.
+
+        std::filesystem::remove(path, errorCode);
+
+        ++misses;
+
+        return {};
+    }
+
+    // Mark the entry as the most recently used one.
+
+    std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), errorCode);
+
+    ++hits;
+
+    return {results, std::move(taskInfos)};
+}
+
+void resultsCacheStore(const ResultsCacheKey &pKey, const libOpenCOR::SedInstancePtr &pSedInstance)
+{
+    if (pKey.name.empty()) {
+        return;
+    }
+
+    auto results = sedInstanceResults(pSedInstance);
+    auto taskInfos = sedInstanceTaskInfos(pSedInstance);
+
+    // Write the entry to disk in a background thread, so as not to block our caller, and without holding our mutex,
+    // so as not to block lookups either.
+    // Note: we write to a uniquely named temporary file that we then rename, so that a partially written entry never
+    //       gets loaded, even if the same entry is being written by another thread.
+
+    auto writer = std::async(std::launch::async, [pKey, results, taskInfos = std::move(taskInfos)]() {
+        uint64_t cacheMaximumSize {0};
+        auto cacheDir = cacheDirectory(&cacheMaximumSize);
+
+        if (cacheDir.empty()) {
+            return;
+        }
+
+        std::error_code errorCode;
+
+        std::filesystem::create_directories(cacheDir, errorCode);
+
+        auto path = cacheDir / (pKey.name + EXTENSION);
+        auto temporaryPath = cacheDir / (pKey.name + "-" + std::to_string(writerId++) + ".tmp");
+
+        {
+            std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+            uint64_t taskCount = results->size();
+
+            file.write(MAGIC, sizeof(MAGIC));
+            file.write(reinterpret_cast<const char *>(&FORMAT_VERSION), sizeof(FORMAT_VERSION));
+            writeString(file, pKey.material);
+            file.write(reinterpret_cast<const char *>(&taskCount), sizeof(taskCount));
+
+            for (size_t i = 0; i < taskCount; ++i) {
+                const auto &taskInfo = taskInfos[i];
+                const auto &taskResults = (*results)[i];
+
+                writeString(file, taskInfo.voiName);
+                writeString(file, taskInfo.voiUnit);
+                writeStrings(file, taskInfo.stateNames);
+                writeStrings(file, taskInfo.stateUnits);
+                writeStrings(file, taskInfo.rateNames);
+                writeStrings(file, taskInfo.rateUnits);
+                writeStrings(file, taskInfo.constantNames);
+                writeStrings(file, taskInfo.constantUnits);
+                writeStrings(file, taskInfo.computedConstantNames);
+                writeStrings(file, taskInfo.computedConstantUnits);
+                writeStrings(file, taskInfo.algebraicVariableNames);
+                writeStrings(file, taskInfo.algebraicVariableUnits);
+                writeDoubles(file, taskResults.voi);
+                writeDoublesList(file, taskResults.states);
+                writeDoublesList(file, taskResults.rates);
+                writeDoublesList(file, taskResults.constants);
+                writeDoublesList(file, taskResults.computedConstants);
+                writeDoublesList(file, taskResults.algebraicVariables);
+            }
+
+            if (!file) {
+                file.close();
+
+                std::filesystem::remove(temporaryPath, errorCode);
+
+                return;
+            }
+        }
+
+        std::filesystem::rename(temporaryPath, path, errorCode);
+
+        if (errorCode) {
+            std::filesystem::remove(temporaryPath, errorCode);
+
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(evictionMutex);
+
+        evict(cacheDir, cacheMaximumSize);
+    });
+
+    // Keep track of our writer, forgetting about the ones that have finished.
+
+    std::lock_guard<std::mutex> lock(writersMutex);
+
+    std::erase_if(writers, [](const auto &pWriter) {
+        return pWriter.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    });
+
+    writers.push_back(std::move(writer));
+}
+
+void resultsCacheWaitForWrites()
+{
+    // Wait for the entries that are being written to our results cache, if any.
+
+    std::vector<std::future<void>> pendingWriters;
+
+    {
+        std::lock_guard<std::mutex> lock(writersMutex);
+
+        pendingWriters.swap(writers);
+    }
+
+    for (auto &writer : pendingWriters) {
+        writer.wait();
+    }
+}
+
+// ResultsCache API.
+
+void resultsCacheConfigure(const Napi::CallbackInfo &pInfo)
+{
+    // Configure our results cache, i.e. where it lives and how big it can get. An empty directory disables it.
+
+    auto directoryPath = toString(pInfo[0]);
+    std::filesystem::path cacheDir = toPath(directoryPath);
+    uint64_t cacheMaximumSize = static_cast<uint64_t>(toDouble(pInfo[1]));
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        directory = cacheDir;
+        maximumSize = cacheMaximumSize;
+    }
+
+    if (!cacheDir.empty()) {
+        std::lock_guard<std::mutex> lock(evictionMutex);
+
+        evict(cacheDir, cacheMaximumSize);
+    }
+}
+
+napi_value resultsCacheStatistics(const Napi::CallbackInfo &pInfo)
+{
+    auto env = pInfo.Env();
+    auto res = Napi::Object::New(env);
+    auto cacheDir = cacheDirectory();
+    uint64_t entryCount {0};
+    uint64_t size {0};
+    std::error_code errorCode;
+
+    if (!cacheDir.empty()) {
+        for (const auto &entry : std::filesystem::directory_iterator(cacheDir, errorCode)) {
+            if (entry.is_regular_file(errorCode) && (entry.path().extension() == EXTENSION)) {
+                ++entryCount;
+
+                size += entry.file_size(errorCode);
+            }
+        }
+    }
+
+    res.Set("hits", Napi::Number::New(env, static_cast<double>(hits)));
+    res.Set("misses", Napi::Number::New(env, static_cast<double>(misses)));
+    res.Set("evictions", Napi::Number::New(env, static_cast<double>(evictions)));
+    res.Set("entryCount", Napi::Number::New(env, static_cast<double>(entryCount)));
+    res.Set("size", Napi::Number::New(env, static_cast<double>(size)));
+
+    return res;
+}
+
+void resultsCacheClear(const Napi::CallbackInfo &pInfo)
+{
+    (void)pInfo;
+
+    auto cacheDir = cacheDirectory();
+    std::error_code errorCode;
+
+    if (!cacheDir.empty()) {
+        std::lock_guard<std::mutex> lock(evictionMutex);
+
+        for (const auto &entry : std::filesystem::directory_iterator(cacheDir, errorCode)) {
+            if (entry.path().extension() == EXTENSION) {
+                std::filesystem::remove(entry.path(), errorCode);
+            }
+        }
+    }
+
+    hits = 0;
+    misses = 0;
+    evictions = 0;
+}
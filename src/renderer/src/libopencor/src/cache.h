@@ -0,0 +1,83 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+#include <libopencor>
+
+#include <napi.h>
+
+struct EnvData;
+
+// The results of a SED-ML instance, as stored in our results cache or spilled to disk by our memory accounting.
+
+struct SedInstanceTaskResults
+{
+    std::vector<double> voi;
+    std::vector<std::vector<double>> states;
+    std::vector<std::vector<double>> rates;
+    std::vector<std::vector<double>> constants;
+    std::vector<std::vector<double>> computedConstants;
+    std::vector<std::vector<double>> algebraicVariables;
+};
+
+using SedInstanceResults = std::vector<SedInstanceTaskResults>;
+using SedInstanceResultsPtr = std::shared_ptr<const SedInstanceResults>;
+
+// The names and units of the variables of a task of a SED-ML instance, for when we have no libOpenCOR instance for it
+// (i.e. its results come from our results cache or it got released by our memory accounting).
+
+struct SedInstanceTaskInfo
+{
+    std::string voiName;
+    std::string voiUnit;
+    std::vector<std::string> stateNames;
+    std::vector<std::string> stateUnits;
+    std::vector<std::string> rateNames;
+    std::vector<std::string> rateUnits;
+    std::vector<std::string> constantNames;
+    std::vector<std::string> constantUnits;
+    std::vector<std::string> computedConstantNames;
+    std::vector<std::string> computedConstantUnits;
+    std::vector<std::string> algebraicVariableNames;
+    std::vector<std::string> algebraicVariableUnits;
+};
+
+using SedInstanceTaskInfos = std::vector<SedInstanceTaskInfo>;
+
+SedInstanceResultsPtr sedInstanceResults(const libOpenCOR::SedInstancePtr &pSedInstance);
+SedInstanceTaskInfos sedInstanceTaskInfos(const libOpenCOR::SedInstancePtr &pSedInstance);
+
+// The key of an entry in our results cache.
+// Note: material is everything that the results of a SED-ML instance depend on while name is a hash of it, which we
+//       use as a file name. Since different materials may have the same name, an entry also stores its material, which
+//       gets checked when loading the entry.
+
+struct ResultsCacheKey
+{
+    std::string name;
+    std::string material;
+};
+
+// An entry in our results cache, i.e. the results of a SED-ML instance and the names and units of its variables, which
+// is all we need to skip instantiating (i.e. analysing and compiling) its model and running its simulation.
+
+struct ResultsCacheEntry
+{
+    SedInstanceResultsPtr results;
+    SedInstanceTaskInfos taskInfos;
+};
+
+bool resultsCacheEnabled();
+std::optional<std::string> resultsCacheModelFiles(const EnvData &pEnvData, const libOpenCOR::SedDocumentPtr &pSedDocument);
+ResultsCacheKey resultsCacheKey(const libOpenCOR::SedDocumentPtr &pSedDocument, const std::string &pModelFiles);
+ResultsCacheEntry resultsCacheLoad(const ResultsCacheKey &pKey);
+void resultsCacheStore(const ResultsCacheKey &pKey, const libOpenCOR::SedInstancePtr &pSedInstance);
+void resultsCacheWaitForWrites();
+
+// ResultsCache API.
+
+void resultsCacheConfigure(const Napi::CallbackInfo &pInfo);
+napi_value resultsCacheStatistics(const Napi::CallbackInfo &pInfo);
+void resultsCacheClear(const Napi::CallbackInfo &pInfo);
@@ -1,23 +1,495 @@
 #include "common.h"
+#include "scheduler.h"
+
+#include <atomic>
+
+namespace {
+
+// A file that libOpenCOR's file manager manages on behalf of one or several environments.
+// Note: openers are the environments that opened the file, while dependentPaths are the paths of the files that
+//       libOpenCOR's file manager started managing because of it. A file is needed as long as it can be reached from a
+//       file that has an opener. importsResolved tells whether the files imported by the file (if it is a model) are
+//       managed, i.e. whether the file has been successfully instantiated.
+
+struct ManagedFile
+{
+    libOpenCOR::FilePtr file;
+    std::set<const EnvData *> openers;
+    std::set<std::string> dependentPaths;
+    bool importsResolved {false};
+};
 
 libOpenCOR::FileManager fileManager = libOpenCOR::FileManager::instance();
-std::map<std::string, libOpenCOR::FilePtr> files;
-std::map<size_t, libOpenCOR::SedDocumentPtr> sedDocuments;
-std::map<size_t, libOpenCOR::SedInstancePtr> sedInstances;
+std::shared_mutex fileManagerMutex;
+std::map<std::string, ManagedFile> managedFiles;
+std::mutex fileReleasesMutex;
+std::vector<std::pair<const EnvData *, std::string>> fileReleases;
+
+std::atomic<size_t> sedDocumentId {0};
+std::atomic<size_t> sedInstanceId {0};
+
+std::set<std::string> reachablePaths(std::vector<std::string> pPaths)
+{
+    // Return the given paths and the paths that can be reached from them through their dependents.
+    // Note: this must be called with libOpenCOR's file manager locked.
+
+    std::set<std::string> res;
+
+    while (!pPaths.empty()) {
+        auto path = std::move(pPaths.back());
+
+        pPaths.pop_back();
+
+        auto managedFile = managedFiles.find(path);
+
+        if ((managedFile == managedFiles.end()) || !res.insert(path).second) {
+            continue;
+        }
+
+        pPaths.insert(pPaths.end(), managedFile->second.dependentPaths.begin(), managedFile->second.dependentPaths.end());
+    }
+
+    return res;
+}
+
+bool isNeededElsewhere(const EnvData &pEnvData, const std::string &pPath)
+{
+    // Return whether the given file is needed by another environment or by another file opened by the given
+    // environment.
+    // Note: this must be called with libOpenCOR's file manager exclusively locked.
+
+    std::vector<std::string> paths;
+
+    for (const auto &[path, managedFile] : managedFiles) {
+        if (!managedFile.openers.empty()
+            && ((path != pPath) || (managedFile.openers.size() > 1) || !managedFile.openers.contains(&pEnvData))) {
+            paths.push_back(path);
+        }
+    }
+
+    return reachablePaths(std::move(paths)).contains(pPath);
+}
+
+void unmanageUnneededFiles()
+{
+    // Have libOpenCOR's file manager unmanage the files that are not needed anymore.
+    // Note: this must be called with libOpenCOR's file manager exclusively locked.
+
+    std::vector<std::string> paths;
+
+    for (const auto &[path, managedFile] : managedFiles) {
+        if (!managedFile.openers.empty()) {
+            paths.push_back(path);
+        }
+    }
+
+    auto neededPaths = reachablePaths(std::move(paths));
+
+    std::erase_if(managedFiles, [&neededPaths](const auto &pManagedFile) {
+        if (neededPaths.contains(pManagedFile.first)) {
+            return false;
+        }
+
+        fileManager.unmanage(pManagedFile.second.file);
+
+        return true;
+    });
+}
+
+void releaseFiles()
+{
+    // Release the files that were closed while libOpenCOR's file manager couldn't be locked.
+    // Note: this must be called with libOpenCOR's file manager exclusively locked.
+
+    std::vector<std::pair<const EnvData *, std::string>> releases;
+
+    {
+        std::lock_guard<std::mutex> lock(fileReleasesMutex);
+
+        releases.swap(fileReleases);
+    }
+
+    if (releases.empty()) {
+        return;
+    }
+
+    for (const auto &[envData, path] : releases) {
+        auto managedFile = managedFiles.find(path);
+
+        if (managedFile != managedFiles.end()) {
+            managedFile->second.openers.erase(envData);
+        }
+    }
+
+    unmanageUnneededFiles();
+}
+
+bool importsResolved(const libOpenCOR::SedDocumentPtr &pSedDocument)
+{
+    // Return whether the files imported by the models of the given SED-ML document are managed.
+    // Note: this must be called with libOpenCOR's file manager locked.
+
+    if (pSedDocument->modelCount() == 0) {
+        return false;
+    }
+
+    for (size_t i = 0; i < pSedDocument->modelCount(); ++i) {
+        auto file = pSedDocument->model(i)->file();
+
+        if (file == nullptr) {
+            return false;
+        }
+
+        auto managedFile = managedFiles.find(file->path());
+
+        if ((managedFile == managedFiles.end()) || !managedFile->second.importsResolved) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void cleanUpEnvData(void *pData)
+{
+    // Our environment is being torn down, so stop our run schedulers (and release their thread-safe function), wait
+    // for the files that are being opened on our behalf, wait for our results cache entries to be written, clean up
+    // our memory accounting (including our spill files), and release our files.
+
+    auto data = static_cast<EnvData *>(pData);
+
+    stopSedRunSchedulers(*data);
+
+    {
+        std::unique_lock<std::mutex> lock(data->fileOpenersMutex);
+
+        data->fileOpenersCondition.wait(lock, [data] {
+            return data->fileOpenerCount == 0;
+        });
+    }
+
+    data->sedInstances.clear();
+    data->sedDocuments.clear();
+    data->openedSedDocuments.clear();
+
+    resultsCacheWaitForWrites();
+    cleanUpMemoryAccounting(*data);
+
+    {
+        std::unique_lock<std::shared_mutex> lock(fileManagerMutex);
+
+        releaseFiles();
+
+        for (auto &managedFile : managedFiles) {
+            managedFile.second.openers.erase(data);
+        }
+
+        unmanageUnneededFiles();
+    }
+
+    data->files.clear();
+    data->openedFiles.clear();
+    data->fileDependents.clear();
+}
+
+} // namespace
+
+FileManagerLock::FileManagerLock(const EnvData &pEnvData)
+    : mLock(fileManagerMutex)
+    , mEnvData(pEnvData)
+{
+    releaseFiles();
+
+    for (const auto &file : fileManager.files()) {
+        mFiles.insert(file);
+    }
+}
+
+libOpenCOR::FilePtr FileManagerLock::open(const std::string &pPath, const std::optional<std::vector<unsigned char>> &pContents)
+{
+    // Open the given file for our environment, i.e. share it if it is already managed and we either were not given any
+    // contents or were given the same contents, or create it otherwise. A file with different contents gets recreated,
+    // but only if it is not needed elsewhere, since its contents may be read without libOpenCOR's file manager being
+    // locked. Otherwise, we return nullptr.
+
+    auto managedFile = managedFiles.find(pPath);
+
+    if (managedFile != managedFiles.end()) {
+        if (!pContents.has_value() || (managedFile->second.file->contents() == *pContents)) {
+            managedFile->second.openers.insert(&mEnvData);
+
+            return managedFile->second.file;
+        }
+
+        if (isNeededElsewhere(mEnvData, pPath)) {
+            return nullptr;
+        }
+
+        managedFile->second.openers.clear();
+
+        unmanageUnneededFiles();
+    }
+
+    auto res = libOpenCOR::File::create(pPath, !pContents.has_value());
+
+    if (pContents.has_value()) {
+        res->setContents(*pContents);
+    }
+
+    newFiles(pPath);
+
+    managedFiles[pPath].file = res;
+    managedFiles[pPath].openers.insert(&mEnvData);
+
+    return res;
+}
+
+libOpenCOR::FilePtrs FileManagerLock::newFiles(const std::string &pParentPath)
+{
+    // Register the files that libOpenCOR's file manager started managing since we last checked as dependents of the
+    // given file or, if that file is unknown (e.g. a SED-ML document without a model), as opened by our environment.
+
+    libOpenCOR::FilePtrs res;
+
+    for (const auto &file : fileManager.files()) {
+        if (mFiles.insert(file).second) {
+            managedFiles[file->path()].file = file;
+
+            res.push_back(file);
+        }
+    }
+
+    auto parent = managedFiles.find(pParentPath);
+
+    for (const auto &file : res) {
+        if (file->path() == pParentPath) {
+            continue;
+        }
+
+        if (parent != managedFiles.end()) {
+            parent->second.dependentPaths.insert(file->path());
+        } else {
+            managedFiles[file->path()].openers.insert(&mEnvData);
+        }
+    }
+
+    return res;
+}
+
+libOpenCOR::FilePtrs FileManagerLock::files(const std::string &pPath) const
+{
+    // Return the given file and its dependents, directly or not.
+
+    libOpenCOR::FilePtrs res;
+
+    for (const auto &path : reachablePaths({pPath})) {
+        res.push_back(managedFiles.at(path).file);
+    }
+
+    return res;
+}
+
+void addFiles(EnvData &pEnvData, const std::string &pParentPath, const libOpenCOR::FilePtrs &pFiles)
+{
+    // Let our environment know about the given files, which libOpenCOR's file manager manages because of the given
+    // file.
+
+    for (const auto &file : pFiles) {
+        pEnvData.files[file->path()] = file;
+
+        if (file->path() != pParentPath) {
+            pEnvData.fileDependents[pParentPath].insert(file->path());
+        }
+    }
+}
+
+void removeFile(EnvData &pEnvData, const std::string &pPath)
+{
+    // Close the given file, i.e. forget about it and about its dependents (unless another file that our environment
+    // opened needs them), and have libOpenCOR's file manager unmanage them (unless another environment needs them).
+    // Note: releasing a file requires libOpenCOR's file manager to be exclusively locked, which may not be possible
+    //       straightaway (e.g. a model may be being instantiated on another thread). In that case, rather than block
+    //       JavaScript, the file gets released the next time libOpenCOR's file manager gets exclusively locked.
+
+    if (pEnvData.openedFiles.erase(pPath) == 0) {
+        return;
+    }
+
+    pEnvData.openedSedDocuments.erase(pPath);
+
+    std::set<std::string> neededPaths;
+    std::vector<std::string> paths(pEnvData.openedFiles.begin(), pEnvData.openedFiles.end());
+
+    while (!paths.empty()) {
+        auto path = std::move(paths.back());
+
+        paths.pop_back();
+
+        if (!neededPaths.insert(path).second) {
+            continue;
+        }
+
+        auto dependentPaths = pEnvData.fileDependents.find(path);
+
+        if (dependentPaths != pEnvData.fileDependents.end()) {
+            paths.insert(paths.end(), dependentPaths->second.begin(), dependentPaths->second.end());
+        }
+    }
+
+    std::erase_if(pEnvData.files, [&neededPaths](const auto &pFile) {
+        return !neededPaths.contains(pFile.first);
+    });
+    std::erase_if(pEnvData.fileDependents, [&neededPaths](const auto &pFileDependents) {
+        return !neededPaths.contains(pFileDependents.first);
+    });
+
+    {
+        std::lock_guard<std::mutex> lock(fileReleasesMutex);
+
+        fileReleases.emplace_back(&pEnvData, pPath);
+    }
+
+    std::unique_lock<std::shared_mutex> lock(fileManagerMutex, std::try_to_lock);
+
+    if (lock.owns_lock()) {
+        releaseFiles();
+    }
+}
+
+std::string sedDocumentModelPath(const libOpenCOR::SedDocumentPtr &pSedDocument)
+{
+    // Return the path of the first model of the given SED-ML document, of which the files imported by its models are
+    // dependents.
+
+    auto file = (pSedDocument->modelCount() != 0) ? pSedDocument->model(0)->file() : nullptr;
+
+    return (file != nullptr) ? file->path() : std::string();
+}
+
+libOpenCOR::SedInstancePtr instantiateSedDocument(const EnvData &pEnvData,
+                                                  const libOpenCOR::SedDocumentPtr &pSedDocument,
+                                                  libOpenCOR::FilePtrs &pNewFiles)
+{
+    // Instantiate the given SED-ML document.
+    // Note: instantiating a SED-ML document may result in libOpenCOR's file manager managing the files imported by its
+    //       models, in which case libOpenCOR's file manager must be exclusively locked. Once those files are managed,
+    //       libOpenCOR only needs to look them up, so other SED-ML documents can be instantiated at the same time.
+
+    {
+        std::shared_lock<std::shared_mutex> lock(fileManagerMutex);
+
+        if (importsResolved(pSedDocument)) {
+            return pSedDocument->instantiate();
+        }
+    }
+
+    FileManagerLock lock(pEnvData);
+    auto res = pSedDocument->instantiate();
+
+    pNewFiles = lock.newFiles(sedDocumentModelPath(pSedDocument));
+
+    if (!res->hasIssues()) {
+        for (size_t i = 0; i < pSedDocument->modelCount(); ++i) {
+            auto file = pSedDocument->model(i)->file();
+            auto managedFile = (file != nullptr) ? managedFiles.find(file->path()) : managedFiles.end();
+
+            if (managedFile != managedFiles.end()) {
+                managedFile->second.importsResolved = true;
+            }
+        }
+    }
+
+    return res;
+}
+
+void initEnvData(Napi::Env pEnv)
+{
+    // Create our data for the given environment and make sure that it gets cleaned up when the environment gets torn
+    // down.
+    // Note: the data itself gets deleted by Node-API once the cleanup hooks have been run.
+
+    auto data = new EnvData();
+
+    pEnv.SetInstanceData(data);
+
+    initMemoryAccounting(pEnv);
+
+    napi_add_env_cleanup_hook(pEnv, cleanUpEnvData, data);
+}
+
+void keepCleanupHookFirst(const Napi::Env &pEnv)
+{
+    // Make sure that our cleanup hook gets run before the cleanup hook of the thread-safe function that was just
+    // created, so that we can stop the threads that use that function and release it before it gets finalised.
+    // Note: Node-API runs cleanup hooks in the reverse order of their registration, and a thread-safe function
+    //       registers its own cleanup hook when it gets created, hence we re-register ours.
+
+    auto data = &envData(pEnv);
+
+    napi_remove_env_cleanup_hook(pEnv, cleanUpEnvData, data);
+    napi_add_env_cleanup_hook(pEnv, cleanUpEnvData, data);
+}
+
+EnvData &envData(const Napi::Env &pEnv)
+{
+    return *pEnv.GetInstanceData<EnvData>();
+}
 
 libOpenCOR::FilePtr toFile(const Napi::Value &pValue)
 {
-    return fileManager.file(pValue.ToString().Utf8Value());
+    // Note: our environment knows about the files it opened and their dependents (e.g. the child files of a COMBINE
+    //       archive), but not about the other files that libOpenCOR's file manager manages.
+
+    auto &files = envData(pValue.Env()).files;
+    auto file = files.find(pValue.ToString().Utf8Value());
+
+    return (file != files.end()) ? file->second : nullptr;
 }
 
-libOpenCOR::SedDocumentPtr toSedDocument(size_t pId)
+libOpenCOR::SedDocumentPtr toSedDocument(const Napi::Value &pValue)
 {
-    return sedDocuments[pId];
+    return envData(pValue.Env()).sedDocuments[toSizeT(pValue)];
 }
 
-libOpenCOR::SedInstancePtr toSedInstance(size_t pId)
+libOpenCOR::SedInstancePtr toSedInstance(const Napi::Value &pValue)
 {
-    return sedInstances[pId];
+    // Note: an instance may have been released by our memory accounting, in which case we return nullptr.
+
+    auto &sedInstances = envData(pValue.Env()).sedInstances;
+    auto sedInstance = sedInstances.find(toSizeT(pValue));
+
+    return (sedInstance != sedInstances.end()) ? sedInstance->second : nullptr;
+}
+
+size_t addSedDocument(const Napi::Env &pEnv, const libOpenCOR::SedDocumentPtr &pSedDocument)
+{
+    auto id = sedDocumentId++;
+
+    envData(pEnv).sedDocuments[id] = pSedDocument;
+
+    return id;
+}
+
+size_t addSedInstance(const Napi::Env &pEnv, const libOpenCOR::SedInstancePtr &pSedInstance)
+{
+    auto id = sedInstanceId++;
+
+    envData(pEnv).sedInstances[id] = pSedInstance;
+
+    return id;
+}
+
+size_t addCachedSedInstance(const Napi::Env &pEnv, const ResultsCacheEntry &pResultsCacheEntry)
+{
+    // Note: an instance which results come from our results cache has no libOpenCOR instance.
+
+    auto id = sedInstanceId++;
+    auto &data = envData(pEnv);
+
+    data.sedInstanceCachedResults[id] = pResultsCacheEntry.results;
+    data.sedInstanceMemory[id].taskInfos = pResultsCacheEntry.taskInfos;
+
+    return id;
 }
 
 size_t toSizeT(const Napi::Value &pValue)
@@ -40,16 +512,15 @@ std::string toString(const Napi::Value &pValue)
     return pValue.As<Napi::String>().Utf8Value();
 }
 
-napi_value issues(const Napi::CallbackInfo &pInfo, libOpenCOR::IssuePtrs pIssues)
+napi_value issues(const Napi::Env &pEnv, libOpenCOR::IssuePtrs pIssues)
 {
-    auto env = pInfo.Env();
-    auto res = Napi::Array::New(env);
+    auto res = Napi::Array::New(pEnv);
 
     for (const auto &issue : pIssues) {
-        auto object = Napi::Object::New(env);
+        auto object = Napi::Object::New(pEnv);
 
-        object.Set("type", Napi::Number::New(env, static_cast<int>(issue->type())));
-        object.Set("description", Napi::String::New(env, issue->description()));
+        object.Set("type", Napi::Number::New(pEnv, static_cast<int>(issue->type())));
+        object.Set("description", Napi::String::New(pEnv, issue->description()));
 
         res.Set(res.Length(), object);
     }
@@ -57,6 +528,11 @@ napi_value issues(const Napi::CallbackInfo &pInfo, libOpenCOR::IssuePtrs pIssues
     return res;
 }
 
+napi_value issues(const Napi::CallbackInfo &pInfo, libOpenCOR::IssuePtrs pIssues)
+{
+    return issues(pInfo.Env(), pIssues);
+}
+
 napi_value doublesToNapiFloat64Array(const Napi::Env &pEnv, std::span<const double> pDoubles)
 {
     const size_t byteLength = pDoubles.size() * sizeof(double);
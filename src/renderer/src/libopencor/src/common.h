@@ -1,24 +1,113 @@
 #pragma once
 
+#include <condition_variable>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <shared_mutex>
 #include <span>
 #include <libopencor>
 
 #include <napi.h>
 
-extern libOpenCOR::FileManager fileManager;
-extern std::map<std::string, libOpenCOR::FilePtr> files;
-extern std::map<size_t, libOpenCOR::SedDocumentPtr> sedDocuments;
-extern std::map<size_t, libOpenCOR::SedInstancePtr> sedInstances;
+#include "budget.h"
+#include "cache.h"
+#include "runstore.h"
+
+class SedRunScheduler;
+
+// Our per-environment data.
+// Note: our native node module may be loaded in several environments (e.g. the main thread and some worker threads),
+//       so each environment gets its own registry of files, SED-ML documents, SED-ML instances, and run schedulers.
+//       Its files are the files it opened and the files that libOpenCOR's file manager started managing because of
+//       them (i.e. their dependents, e.g. the child files of a COMBINE archive or the files imported by a model). The
+//       SED-ML document that gets created when a file is opened asynchronously is kept until it is used (see
+//       sedDocumentCreate()) or its file is closed. Our environment also keeps track of the results cache key of our
+//       SED-ML instances, of the instances which results are to be cached once their run has completed, and of the
+//       instances which results come from the results cache (in which case they have no libOpenCOR instance) or from
+//       disk (if they were spilled). Finally, it keeps track of the memory used by the results of our instances (which
+//       is accounted for process-wide, see budget.cpp), it holds the runs of our run store, and it counts the files
+//       that are being opened on a worker thread, so that we can wait for them when our environment is being torn
+//       down.
+//       libOpenCOR's file manager is, however, a process-wide singleton, so access to it must be synchronised using a
+//       FileManagerLock (see below).
+
+struct EnvData
+{
+    std::map<std::string, libOpenCOR::FilePtr> files;
+    std::set<std::string> openedFiles;
+    std::map<std::string, std::set<std::string>> fileDependents;
+    std::map<std::string, libOpenCOR::SedDocumentPtr> openedSedDocuments;
+    std::map<size_t, libOpenCOR::SedDocumentPtr> sedDocuments;
+    std::map<size_t, libOpenCOR::SedInstancePtr> sedInstances;
+    std::map<size_t, ResultsCacheKey> sedInstanceCacheKeys;
+    std::set<size_t> sedInstancesToCache;
+    std::map<size_t, SedInstanceResultsPtr> sedInstanceCachedResults;
+    std::map<size_t, std::shared_ptr<SedRunScheduler>> sedRunSchedulers;
+    std::vector<std::weak_ptr<SedRunScheduler>> releasedSedRunSchedulers;
+    std::map<size_t, SedInstanceMemory> sedInstanceMemory;
+    std::map<size_t, StoredRun> storedRuns;
+
+    std::mutex fileOpenersMutex;
+    std::condition_variable fileOpenersCondition;
+    size_t fileOpenerCount {0};
+};
+
+// Exclusive access to libOpenCOR's file manager.
+// Note: libOpenCOR's file manager is a process-wide singleton that keys files by path, and libOpenCOR::File::create()
+//       returns the file that is already managed for a given path, if any. So, we keep track of the environments that
+//       opened a file and of its dependents, so that several environments can share a file (as long as they want it
+//       with the same contents) and so that a file only gets unmanaged once no environment needs it anymore. Since a
+//       file may be read without libOpenCOR's file manager being locked, its contents never change once it has been
+//       opened. Instead, a file that is opened with different contents gets recreated, unless another environment
+//       needs it.
+//       Creating files and SED-ML documents requires exclusive access to libOpenCOR's file manager, as does
+//       instantiating a SED-ML document which imports have not yet been resolved (see instantiateSedDocument()). The
+//       files that libOpenCOR's file manager starts managing in the meantime must be registered using newFiles() and
+//       then added to the environment using addFiles(), which must be done on the JavaScript thread.
+
+class FileManagerLock
+{
+public:
+    explicit FileManagerLock(const EnvData &pEnvData);
+
+    libOpenCOR::FilePtr open(const std::string &pPath, const std::optional<std::vector<unsigned char>> &pContents);
+
+    libOpenCOR::FilePtrs newFiles(const std::string &pParentPath);
+    libOpenCOR::FilePtrs files(const std::string &pPath) const;
+
+private:
+    std::unique_lock<std::shared_mutex> mLock;
+    const EnvData &mEnvData;
+    std::set<libOpenCOR::FilePtr> mFiles;
+};
+
+void addFiles(EnvData &pEnvData, const std::string &pParentPath, const libOpenCOR::FilePtrs &pFiles);
+void removeFile(EnvData &pEnvData, const std::string &pPath);
+
+std::string sedDocumentModelPath(const libOpenCOR::SedDocumentPtr &pSedDocument);
+libOpenCOR::SedInstancePtr instantiateSedDocument(const EnvData &pEnvData,
+                                                  const libOpenCOR::SedDocumentPtr &pSedDocument,
+                                                  libOpenCOR::FilePtrs &pNewFiles);
+
+void initEnvData(Napi::Env pEnv);
+void keepCleanupHookFirst(const Napi::Env &pEnv);
+EnvData &envData(const Napi::Env &pEnv);
 
 libOpenCOR::FilePtr toFile(const Napi::Value &pValue);
-libOpenCOR::SedDocumentPtr toSedDocument(size_t pId);
-libOpenCOR::SedInstancePtr toSedInstance(size_t pId);
+libOpenCOR::SedDocumentPtr toSedDocument(const Napi::Value &pValue);
+libOpenCOR::SedInstancePtr toSedInstance(const Napi::Value &pValue);
+size_t addSedDocument(const Napi::Env &pEnv, const libOpenCOR::SedDocumentPtr &pSedDocument);
+size_t addSedInstance(const Napi::Env &pEnv, const libOpenCOR::SedInstancePtr &pSedInstance);
+size_t addCachedSedInstance(const Napi::Env &pEnv, const ResultsCacheEntry &pResultsCacheEntry);
 size_t toSizeT(const Napi::Value &pValue);
 int32_t toInt32(const Napi::Value &pValue);
 double toDouble(const Napi::Value &pValue);
 std::string toString(const Napi::Value &pValue);
 
+napi_value issues(const Napi::Env &pEnv, libOpenCOR::IssuePtrs pIssues);
 napi_value issues(const Napi::CallbackInfo &pInfo, libOpenCOR::IssuePtrs pIssues);
 
 napi_value doublesToNapiFloat64Array(const Napi::Env &pEnv, std::span<const double> pDoubles);
@@ -0,0 +1,87 @@
+#include "compression.h"
+
+#include <bit>
+#include <cmath>
+
+namespace {
+
+uint64_t prediction(std::span<const double> pDoubles, size_t pIndex)
+{
+    // Predict a value from the previous two, falling back to the previous one (or zero) if needed.
+    // Note: the prediction must be computed in exactly the same way when compressing and decompressing. This is the
+    //       case since, our compression being lossless, the values that got decompressed are the original values.
+
+    if (pIndex == 0) {
+        return 0;
+    }
+
+    auto previous = pDoubles[pIndex - 1];
+
+    if (pIndex > 1) {
+        auto res = 2.0 * previous - pDoubles[pIndex - 2];
+
+        if (std::isfinite(res)) {
+            return std::bit_cast<uint64_t>(res);
+        }
+    }
+
+    return std::bit_cast<uint64_t>(previous);
+}
+
+} // namespace
+
+std::vector<uint8_t> compressDoubles(std::span<const double> pDoubles)
+{
+    std::vector<uint8_t> res;
+
+    res.reserve(pDoubles.size() * 2);
+
+    for (size_t i = 0; i < pDoubles.size(); ++i) {
+        auto residual = std::bit_cast<uint64_t>(pDoubles[i]) ^ prediction(pDoubles, i);
+        auto leadingBytes = std::countl_zero(residual) / 8;
+        auto trailingBytes = (residual == 0) ? 0 : std::countr_zero(residual) / 8;
+
+        res.push_back(static_cast<uint8_t>((leadingBytes << 4) | trailingBytes));
+
+        for (auto j = trailingBytes; j < 8 - leadingBytes; ++j) {
+            res.push_back(static_cast<uint8_t>(residual >> (8 * j)));
+        }
+    }
+
+    res.shrink_to_fit();
+
+    return res;
+}
+
+bool decompressDoubles(std::span<const uint8_t> pBytes, size_t pCount, std::vector<double> &pDoubles)
+{
+    pDoubles.clear();
+    pDoubles.reserve(pCount);
+
+    size_t position = 0;
+
+    while (pDoubles.size() < pCount) {
+        if (position == pBytes.size()) {
+            return false;
+        }
+
+        auto header = pBytes[position++];
+        int leadingBytes = header >> 4;
+        int trailingBytes = header & 0xf;
+
+        if ((leadingBytes + trailingBytes > 8)
+            || (pBytes.size() - position < static_cast<size_t>(8 - leadingBytes - trailingBytes))) {
+            return false;
+        }
+
+        uint64_t residual = 0;
+
+        for (auto i = trailingBytes; i < 8 - leadingBytes; ++i) {
+            residual |= static_cast<uint64_t>(pBytes[position++]) << (8 * i);
+        }
+
+        pDoubles.push_back(std::bit_cast<double>(residual ^ prediction(pDoubles, pDoubles.size())));
+    }
+
+    return position == pBytes.size();
+}
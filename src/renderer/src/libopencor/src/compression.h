@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// Lossless compression of a series of doubles.
+// Note: each value is predicted from the previous two (i.e. linear extrapolation, which is exact for a uniform time
+//       course), XOR'ed with its prediction, and only the non-zero bytes of the result get stored, preceded by a byte
+//       giving the number of leading and trailing zero bytes. Smooth time-course series therefore compress well.
+
+std::vector<uint8_t> compressDoubles(std::span<const double> pDoubles);
+bool decompressDoubles(std::span<const uint8_t> pBytes, size_t pCount, std::vector<double> &pDoubles);
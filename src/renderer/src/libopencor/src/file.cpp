@@ -2,29 +2,184 @@
 #include "file.h"
 
 #include <libopencor>
+#include <optional>
 
 // FileManager API.
 
 void fileManagerUnmanage(const Napi::CallbackInfo &pInfo)
 {
-    auto filePath = pInfo[0].ToString().Utf8Value();
+    removeFile(envData(pInfo.Env()), pInfo[0].ToString().Utf8Value());
+}
+
+// File API.
+// Note: our getters cope with files that are unknown to our environment (e.g. files that have been unmanaged or that
+//       belong to another environment).
+
+namespace {
+
+constexpr const char *FILE_NOT_AVAILABLE = "The file is already open with different contents.";
+
+std::optional<std::vector<unsigned char>> toContents(const Napi::Value &pValue)
+{
+    if (pValue.Type() != napi_object) {
+        return std::nullopt;
+    }
+
+    auto contents = pValue.As<Napi::Buffer<unsigned char>>();
+
+    return std::vector<unsigned char>(contents.Data(), contents.Data() + contents.Length());
+}
+
+// Open a file asynchronously.
+// Note: libOpenCOR decompresses a COMBINE archive when it creates the corresponding file. We then retrieve its UI JSON
+//       and create its SED-ML document. All of this is done away from the JavaScript thread, which only gets to
+//       register the file and its SED-ML document once they are ready. However, creating the file and its SED-ML
+//       document requires libOpenCOR's file manager to be exclusively locked, so several files are effectively opened
+//       one after the other. Neither can the child files of a COMBINE archive be parsed and validated concurrently
+//       since libOpenCOR parses them when decompressing the archive and only validates them when instantiating the
+//       SED-ML document, which it does as a whole. The issues of those child files get merged into the issues of the
+//       archive. The SED-ML document is kept by our environment until it gets used (see sedDocumentCreate()).
+//       Our environment counts us until we have been executed, so that it can wait for us when it is being torn down.
+
+class FileOpenWorker : public Napi::AsyncWorker
+{
+public:
+    explicit FileOpenWorker(const Napi::Env &pEnv, const std::string &pPath,
+                            std::optional<std::vector<unsigned char>> &&pContents);
+
+    Napi::Promise promise() const;
+
+    void Execute() override;
+    void OnOK() override;
+    void OnError(const Napi::Error &pError) override;
+
+private:
+    Napi::Promise::Deferred mDeferred;
+    EnvData &mEnvData;
+    std::string mPath;
+    std::optional<std::vector<unsigned char>> mContents;
+
+    libOpenCOR::FilePtr mFile;
+    libOpenCOR::FilePtrs mFiles;
+    libOpenCOR::IssuePtrs mIssues;
+    std::optional<std::vector<unsigned char>> mUiJson;
+    libOpenCOR::SedDocumentPtr mSedDocument;
+
+    void open();
+};
+
+FileOpenWorker::FileOpenWorker(const Napi::Env &pEnv, const std::string &pPath,
+                               std::optional<std::vector<unsigned char>> &&pContents)
+    : Napi::AsyncWorker(pEnv)
+    , mDeferred(Napi::Promise::Deferred::New(pEnv))
+    , mEnvData(envData(pEnv))
+    , mPath(pPath)
+    , mContents(std::move(pContents))
+{
+    std::lock_guard<std::mutex> lock(mEnvData.fileOpenersMutex);
+
+    ++mEnvData.fileOpenerCount;
+}
 
-    for (auto file : fileManager.files()) {
-        if (file->path() == filePath) {
-            files.erase(filePath);
+Napi::Promise FileOpenWorker::promise() const
+{
+    return mDeferred.Promise();
+}
+
+void FileOpenWorker::Execute()
+{
+    open();
+
+    std::lock_guard<std::mutex> lock(mEnvData.fileOpenersMutex);
+
+    --mEnvData.fileOpenerCount;
+
+    mEnvData.fileOpenersCondition.notify_all();
+}
+
+void FileOpenWorker::open()
+{
+    // Open the file.
+
+    FileManagerLock lock(mEnvData);
+
+    mFile = lock.open(mPath, mContents);
 
-            fileManager.unmanage(file);
+    if (mFile == nullptr) {
+        SetError(FILE_NOT_AVAILABLE);
 
-            break;
+        return;
+    }
+
+    mIssues = mFile->issues();
+
+    for (const auto &childFile : mFile->childFiles()) {
+        auto childIssues = childFile->issues();
+
+        mIssues.insert(mIssues.end(), childIssues.begin(), childIssues.end());
+    }
+
+    auto type = mFile->type();
+
+    if ((type != libOpenCOR::File::Type::UNKNOWN_FILE) && (type != libOpenCOR::File::Type::IRRETRIEVABLE_FILE)) {
+        // Retrieve the UI JSON, if any, and create the SED-ML document.
+        // Note: creating a SED-ML document may result in libOpenCOR's file manager managing new files.
+
+        auto uiJson = mFile->childFile("simulation.json");
+
+        if (uiJson != nullptr) {
+            mUiJson = uiJson->contents();
         }
+
+        mSedDocument = libOpenCOR::SedDocument::create(mFile);
+
+        lock.newFiles(mPath);
     }
+
+    mFiles = lock.files(mPath);
 }
 
-// File API.
+void FileOpenWorker::OnOK()
+{
+    // Keep track of the file (and of the files that libOpenCOR's file manager manages because of it), and of its SED-ML
+    // document, if any.
+
+    auto env = Env();
+    auto &data = envData(env);
+    auto res = Napi::Object::New(env);
+
+    data.openedFiles.insert(mPath);
+
+    addFiles(data, mPath, mFiles);
+
+    res.Set("issues", issues(env, mIssues));
+
+    if (mUiJson.has_value()) {
+        res.Set("uiJson", Napi::Buffer<unsigned char>::Copy(env, mUiJson->data(), mUiJson->size()));
+    }
+
+    if (mSedDocument != nullptr) {
+        data.openedSedDocuments[mPath] = mSedDocument;
+    }
+
+    mDeferred.Resolve(res);
+}
+
+void FileOpenWorker::OnError(const Napi::Error &pError)
+{
+    mDeferred.Reject(pError.Value());
+}
+
+} // namespace
 
 napi_value fileContents(const Napi::CallbackInfo &pInfo)
 {
     auto file = toFile(pInfo[0]);
+
+    if (file == nullptr) {
+        return pInfo.Env().Undefined();
+    }
+
     auto res = file->contents();
 
     return Napi::Buffer<unsigned char>::Copy(pInfo.Env(), res.data(), res.size());
@@ -32,34 +187,87 @@ napi_value fileContents(const Napi::CallbackInfo &pInfo)
 
 void fileCreate(const Napi::CallbackInfo &pInfo)
 {
-    auto contents = (pInfo[1].Type() == napi_object) ? pInfo[1].As<Napi::Buffer<unsigned char>>() : Napi::Buffer<unsigned char>();
-    auto file = libOpenCOR::File::create(pInfo[0].ToString().Utf8Value(), contents.IsEmpty());
+    auto path = pInfo[0].ToString().Utf8Value();
+    auto &data = envData(pInfo.Env());
+    libOpenCOR::FilePtrs files;
+
+    {
+        FileManagerLock lock(data);
+
+        if (lock.open(path, toContents(pInfo[1])) == nullptr) {
+            Napi::Error::New(pInfo.Env(), FILE_NOT_AVAILABLE).ThrowAsJavaScriptException();
 
-    if (!contents.IsEmpty()) {
-        file->setContents(std::vector<unsigned char>(contents.Data(), contents.Data() + contents.Length()));
+            return;
+        }
+
+        files = lock.files(path);
     }
 
-    // Keep track of the file so that it doesn't get garbage collected.
+    // Keep track of the file (and of the files that libOpenCOR's file manager manages because of it), and forget about
+    // the SED-ML document that was created when it was last opened asynchronously since it may have been recreated.
+
+    data.openedFiles.insert(path);
+    data.openedSedDocuments.erase(path);
+
+    addFiles(data, path, files);
+}
+
+napi_value fileOpen(const Napi::CallbackInfo &pInfo)
+{
+    // Open the given file asynchronously and return a promise that resolves to its issues and its UI JSON (if any).
+    // Note: Node-API deletes our worker once it has completed.
+
+    auto worker = new FileOpenWorker(pInfo.Env(), pInfo[0].ToString().Utf8Value(), toContents(pInfo[1]));
+    auto res = worker->promise();
+
+    worker->Queue();
 
-    files[file->path()] = file;
+    return res;
 }
 
 napi_value fileIssues(const Napi::CallbackInfo &pInfo)
 {
-    return issues(pInfo, toFile(pInfo[0])->issues());
+    auto file = toFile(pInfo[0]);
+
+    if (file == nullptr) {
+        return issues(pInfo, {});
+    }
+
+    return issues(pInfo, file->issues());
 }
 
 napi_value fileType(const Napi::CallbackInfo &pInfo)
 {
     auto file = toFile(pInfo[0]);
 
+    if (file == nullptr) {
+        return Napi::Number::New(pInfo.Env(), static_cast<int>(libOpenCOR::File::Type::UNKNOWN_FILE));
+    }
+
     return Napi::Number::New(pInfo.Env(), static_cast<int>(file->type()));
 }
 
 napi_value fileUiJson(const Napi::CallbackInfo &pInfo)
 {
     auto file = toFile(pInfo[0]);
-    auto uiJson = file->childFile("simulation.json");
+    auto &data = envData(pInfo.Env());
+    libOpenCOR::FilePtr uiJson;
+    libOpenCOR::FilePtrs newFiles;
+
+    if (file == nullptr) {
+        return pInfo.Env().Undefined();
+    }
+
+    {
+        // Note: the child files of a COMBINE archive get managed by libOpenCOR's file manager.
+
+        FileManagerLock lock(data);
+
+        uiJson = file->childFile("simulation.json");
+        newFiles = lock.newFiles(file->path());
+    }
+
+    addFiles(data, file->path(), newFiles);
 
     if (uiJson == nullptr) {
         return pInfo.Env().Undefined();
@@ -1,15 +1,35 @@
+#include "budget.h"
+#include "cache.h"
+#include "common.h"
 #include "file.h"
+#include "runstore.h"
+#include "scheduler.h"
 #include "sed.h"
 #include "version.h"
 
 Napi::Object init(Napi::Env pEnv, Napi::Object pExports)
 {
+    // Create our per-environment data.
+
+    initEnvData(pEnv);
+
     // Note: this must be in sync with src/preload/index.ts.
 
     // Some general methods.
 
     pExports.Set(Napi::String::New(pEnv, "version"), Napi::Function::New(pEnv, version));
 
+    // ResultsCache API.
+
+    pExports.Set(Napi::String::New(pEnv, "resultsCacheConfigure"), Napi::Function::New(pEnv, resultsCacheConfigure));
+    pExports.Set(Napi::String::New(pEnv, "resultsCacheStatistics"), Napi::Function::New(pEnv, resultsCacheStatistics));
+    pExports.Set(Napi::String::New(pEnv, "resultsCacheClear"), Napi::Function::New(pEnv, resultsCacheClear));
+
+    // Memory API.
+
+    pExports.Set(Napi::String::New(pEnv, "memorySetBudget"), Napi::Function::New(pEnv, memorySetBudget));
+    pExports.Set(Napi::String::New(pEnv, "memoryUsage"), Napi::Function::New(pEnv, memoryUsage));
+
     // FileManager API.
 
     pExports.Set(Napi::String::New(pEnv, "fileManagerUnmanage"), Napi::Function::New(pEnv, fileManagerUnmanage));
@@ -18,6 +38,7 @@ Napi::Object init(Napi::Env pEnv, Napi::Object pExports)
 
     pExports.Set(Napi::String::New(pEnv, "fileContents"), Napi::Function::New(pEnv, fileContents));
     pExports.Set(Napi::String::New(pEnv, "fileCreate"), Napi::Function::New(pEnv, fileCreate));
+    pExports.Set(Napi::String::New(pEnv, "fileOpen"), Napi::Function::New(pEnv, fileOpen));
     pExports.Set(Napi::String::New(pEnv, "fileIssues"), Napi::Function::New(pEnv, fileIssues));
     pExports.Set(Napi::String::New(pEnv, "fileType"), Napi::Function::New(pEnv, fileType));
     pExports.Set(Napi::String::New(pEnv, "fileUiJson"), Napi::Function::New(pEnv, fileUiJson));
@@ -53,11 +74,40 @@ Napi::Object init(Napi::Env pEnv, Napi::Object pExports)
     pExports.Set(Napi::String::New(pEnv, "sedUniformTimeCourseNumberOfSteps"), Napi::Function::New(pEnv, sedUniformTimeCourseNumberOfSteps));
     pExports.Set(Napi::String::New(pEnv, "sedUniformTimeCourseSetNumberOfSteps"), Napi::Function::New(pEnv, sedUniformTimeCourseSetNumberOfSteps));
 
+    // SedSimulation API.
+
+    pExports.Set(Napi::String::New(pEnv, "sedSimulationOdeSolverType"), Napi::Function::New(pEnv, sedSimulationOdeSolverType));
+    pExports.Set(Napi::String::New(pEnv, "sedSimulationSetOdeSolverType"), Napi::Function::New(pEnv, sedSimulationSetOdeSolverType));
+
     // SolverCvode API.
-    // TODO: this is only temporary until we have full support for our different solvers.
 
     pExports.Set(Napi::String::New(pEnv, "solverCvodeMaximumStep"), Napi::Function::New(pEnv, solverCvodeMaximumStep));
     pExports.Set(Napi::String::New(pEnv, "solverCvodeSetMaximumStep"), Napi::Function::New(pEnv, solverCvodeSetMaximumStep));
+    pExports.Set(Napi::String::New(pEnv, "solverCvodeMaximumNumberOfSteps"), Napi::Function::New(pEnv, solverCvodeMaximumNumberOfSteps));
+    pExports.Set(Napi::String::New(pEnv, "solverCvodeSetMaximumNumberOfSteps"), Napi::Function::New(pEnv, solverCvodeSetMaximumNumberOfSteps));
+    pExports.Set(Napi::String::New(pEnv, "solverCvodeIntegrationMethod"), Napi::Function::New(pEnv, solverCvodeIntegrationMethod));
+    pExports.Set(Napi::String::New(pEnv, "solverCvodeSetIntegrationMethod"), Napi::Function::New(pEnv, solverCvodeSetIntegrationMethod));
+    pExports.Set(Napi::String::New(pEnv, "solverCvodeIterationType"), Napi::Function::New(pEnv, solverCvodeIterationType));
+    pExports.Set(Napi::String::New(pEnv, "solverCvodeSetIterationType"), Napi::Function::New(pEnv, solverCvodeSetIterationType));
+    pExports.Set(Napi::String::New(pEnv, "solverCvodeLinearSolver"), Napi::Function::New(pEnv, solverCvodeLinearSolver));
+    pExports.Set(Napi::String::New(pEnv, "solverCvodeSetLinearSolver"), Napi::Function::New(pEnv, solverCvodeSetLinearSolver));
+    pExports.Set(Napi::String::New(pEnv, "solverCvodePreconditioner"), Napi::Function::New(pEnv, solverCvodePreconditioner));
+    pExports.Set(Napi::String::New(pEnv, "solverCvodeSetPreconditioner"), Napi::Function::New(pEnv, solverCvodeSetPreconditioner));
+    pExports.Set(Napi::String::New(pEnv, "solverCvodeUpperHalfBandwidth"), Napi::Function::New(pEnv, solverCvodeUpperHalfBandwidth));
+    pExports.Set(Napi::String::New(pEnv, "solverCvodeSetUpperHalfBandwidth"), Napi::Function::New(pEnv, solverCvodeSetUpperHalfBandwidth));
+    pExports.Set(Napi::String::New(pEnv, "solverCvodeLowerHalfBandwidth"), Napi::Function::New(pEnv, solverCvodeLowerHalfBandwidth));
+    pExports.Set(Napi::String::New(pEnv, "solverCvodeSetLowerHalfBandwidth"), Napi::Function::New(pEnv, solverCvodeSetLowerHalfBandwidth));
+    pExports.Set(Napi::String::New(pEnv, "solverCvodeRelativeTolerance"), Napi::Function::New(pEnv, solverCvodeRelativeTolerance));
+    pExports.Set(Napi::String::New(pEnv, "solverCvodeSetRelativeTolerance"), Napi::Function::New(pEnv, solverCvodeSetRelativeTolerance));
+    pExports.Set(Napi::String::New(pEnv, "solverCvodeAbsoluteTolerance"), Napi::Function::New(pEnv, solverCvodeAbsoluteTolerance));
+    pExports.Set(Napi::String::New(pEnv, "solverCvodeSetAbsoluteTolerance"), Napi::Function::New(pEnv, solverCvodeSetAbsoluteTolerance));
+    pExports.Set(Napi::String::New(pEnv, "solverCvodeInterpolateSolution"), Napi::Function::New(pEnv, solverCvodeInterpolateSolution));
+    pExports.Set(Napi::String::New(pEnv, "solverCvodeSetInterpolateSolution"), Napi::Function::New(pEnv, solverCvodeSetInterpolateSolution));
+
+    // SolverFixedStep API.
+
+    pExports.Set(Napi::String::New(pEnv, "solverFixedStepStep"), Napi::Function::New(pEnv, solverFixedStepStep));
+    pExports.Set(Napi::String::New(pEnv, "solverFixedStepSetStep"), Napi::Function::New(pEnv, solverFixedStepSetStep));
 
     // SedInstance API.
 
@@ -70,9 +120,18 @@ Napi::Object init(Napi::Env pEnv, Napi::Object pExports)
     pExports.Set(Napi::String::New(pEnv, "sedInstancePauseRun"), Napi::Function::New(pEnv, sedInstancePauseRun));
     pExports.Set(Napi::String::New(pEnv, "sedInstanceResumeRun"), Napi::Function::New(pEnv, sedInstanceResumeRun));
     pExports.Set(Napi::String::New(pEnv, "sedInstanceStopRun"), Napi::Function::New(pEnv, sedInstanceStopRun));
+    pExports.Set(Napi::String::New(pEnv, "sedInstanceResultBytes"), Napi::Function::New(pEnv, sedInstanceResultBytes));
+    pExports.Set(Napi::String::New(pEnv, "sedInstanceReloadResults"), Napi::Function::New(pEnv, sedInstanceReloadResults));
+
+    // SedRunScheduler API.
+
+    pExports.Set(Napi::String::New(pEnv, "sedRunSchedulerCreate"), Napi::Function::New(pEnv, sedRunSchedulerCreate));
+    pExports.Set(Napi::String::New(pEnv, "sedRunSchedulerRequestRun"), Napi::Function::New(pEnv, sedRunSchedulerRequestRun));
+    pExports.Set(Napi::String::New(pEnv, "sedRunSchedulerRelease"), Napi::Function::New(pEnv, sedRunSchedulerRelease));
 
     // SedInstanceTask API.
 
+    pExports.Set(Napi::String::New(pEnv, "sedInstanceTaskResultsAvailable"), Napi::Function::New(pEnv, sedInstanceTaskResultsAvailable));
     pExports.Set(Napi::String::New(pEnv, "sedInstanceTaskVoiName"), Napi::Function::New(pEnv, sedInstanceTaskVoiName));
     pExports.Set(Napi::String::New(pEnv, "sedInstanceTaskVoiUnit"), Napi::Function::New(pEnv, sedInstanceTaskVoiUnit));
     pExports.Set(Napi::String::New(pEnv, "sedInstanceTaskVoi"), Napi::Function::New(pEnv, sedInstanceTaskVoi));
@@ -97,6 +156,13 @@ Napi::Object init(Napi::Env pEnv, Napi::Object pExports)
     pExports.Set(Napi::String::New(pEnv, "sedInstanceTaskAlgebraicVariableUnit"), Napi::Function::New(pEnv, sedInstanceTaskAlgebraicVariableUnit));
     pExports.Set(Napi::String::New(pEnv, "sedInstanceTaskAlgebraicVariable"), Napi::Function::New(pEnv, sedInstanceTaskAlgebraicVariable));
 
+    // RunStore API.
+
+    pExports.Set(Napi::String::New(pEnv, "runStoreAdd"), Napi::Function::New(pEnv, runStoreAdd));
+    pExports.Set(Napi::String::New(pEnv, "runStoreTrace"), Napi::Function::New(pEnv, runStoreTrace));
+    pExports.Set(Napi::String::New(pEnv, "runStoreRemove"), Napi::Function::New(pEnv, runStoreRemove));
+    pExports.Set(Napi::String::New(pEnv, "runStoreStatistics"), Napi::Function::New(pEnv, runStoreStatistics));
+
     return pExports;
 }
 
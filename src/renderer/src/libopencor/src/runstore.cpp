@@ -0,0 +1,223 @@
+#include "common.h"
+#include "compression.h"
+#include "runstore.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <span>
+
+namespace {
+
+std::atomic<size_t> storedRunId {0};
+
+const StoredColumn *storedColumn(const Napi::CallbackInfo &pInfo, const Napi::Value &pColumnIndex)
+{
+    auto &storedRuns = envData(pInfo.Env()).storedRuns;
+    auto storedRun = storedRuns.find(toSizeT(pInfo[0]));
+
+    if (storedRun == storedRuns.end()) {
+        return nullptr;
+    }
+
+    auto columnIndex = toSizeT(pColumnIndex);
+
+    return (columnIndex < storedRun->second.size()) ? &storedRun->second[columnIndex] : nullptr;
+}
+
+bool isMonotonic(const std::vector<double> &pValues, size_t pCount)
+{
+    // Return whether the given values never decrease or never increase, ignoring NaN values.
+
+    auto increasing = true;
+    auto decreasing = true;
+    auto previous = std::numeric_limits<double>::quiet_NaN();
+
+    for (size_t i = 0; i < pCount; ++i) {
+        if (std::isnan(pValues[i])) {
+            continue;
+        }
+
+        if (!std::isnan(previous)) {
+            increasing = increasing && (pValues[i] >= previous);
+            decreasing = decreasing && (pValues[i] <= previous);
+
+            if (!increasing && !decreasing) {
+                return false;
+            }
+        }
+
+        previous = pValues[i];
+    }
+
+    return true;
+}
+
+std::vector<size_t> stridedIndices(size_t pCount, size_t pResolution)
+{
+    // Keep 2 * pResolution evenly spaced indices, as well as the last one, so that the shape of a trace which X values
+    // are not monotonic (e.g. a phase plot) is preserved, something that keeping minimum and maximum Y values would
+    // not do.
+
+    std::vector<size_t> res;
+    auto indexCount = 2 * pResolution;
+
+    res.reserve(indexCount + 1);
+
+    for (size_t i = 0; i < indexCount; ++i) {
+        res.push_back(i * pCount / indexCount);
+    }
+
+    if (res.back() != pCount - 1) {
+        res.push_back(pCount - 1);
+    }
+
+    return res;
+}
+
+std::vector<size_t> decimatedIndices(const std::vector<double> &pValues, size_t pCount, size_t pResolution)
+{
+    // Split the values into pResolution buckets and keep, for each bucket, the index of its minimum and maximum values
+    // (in the order in which they appear), so that peaks remain visible however much we decimate.
+    // Note: NaN values are skipped unless a bucket only contains NaN values, in which case we keep its first index.
+
+    std::vector<size_t> res;
+
+    res.reserve(2 * pResolution);
+
+    for (size_t bucket = 0; bucket < pResolution; ++bucket) {
+        auto first = bucket * pCount / pResolution;
+        auto last = (bucket + 1) * pCount / pResolution;
+
+        if (first == last) {
+            continue;
+        }
+
+        auto minimumIndex = first;
+        auto maximumIndex = first;
+
+        for (auto i = first; i < last; ++i) {
+            if (std::isnan(pValues[minimumIndex]) || (pValues[i] < pValues[minimumIndex])) {
+                minimumIndex = i;
+            }
+
+            if (std::isnan(pValues[maximumIndex]) || (pValues[i] > pValues[maximumIndex])) {
+                maximumIndex = i;
+            }
+        }
+
+        res.push_back(std::min(minimumIndex, maximumIndex));
+
+        if (minimumIndex != maximumIndex) {
+            res.push_back(std::max(minimumIndex, maximumIndex));
+        }
+    }
+
+    return res;
+}
+
+} // namespace
+
+// RunStore API.
+
+napi_value runStoreAdd(const Napi::CallbackInfo &pInfo)
+{
+    // Compress the given columns and store them as a new run.
+    // Note: time-course series are smooth, so they compress very well (see compressDoubles()).
+
+    auto columns = pInfo[0].As<Napi::Array>();
+    StoredRun storedRun;
+
+    storedRun.reserve(columns.Length());
+
+    for (uint32_t i = 0; i < columns.Length(); ++i) {
+        auto column = columns.Get(i).As<Napi::Float64Array>();
+        std::span<const double> doubles(column.Data(), column.ElementLength());
+
+        storedRun.push_back({doubles.size(), compressDoubles(doubles)});
+    }
+
+    auto id = storedRunId++;
+
+    envData(pInfo.Env()).storedRuns[id] = std::move(storedRun);
+
+    return Napi::Number::New(pInfo.Env(), static_cast<double>(id));
+}
+
+napi_value runStoreTrace(const Napi::CallbackInfo &pInfo)
+{
+    // Decompress the given X and Y columns of the given run and decimate them to the given resolution (i.e. number of
+    // buckets), unless it is zero or the columns are small enough.
+    // Note: keeping the minimum and maximum Y values of each bucket only makes sense if the X values are monotonic
+    //       (e.g. a time course). Otherwise, we keep evenly spaced points.
+
+    auto env = pInfo.Env();
+    auto res = Napi::Object::New(env);
+    auto xColumn = storedColumn(pInfo, pInfo[1]);
+    auto yColumn = storedColumn(pInfo, pInfo[2]);
+    std::vector<double> x;
+    std::vector<double> y;
+
+    if ((xColumn != nullptr) && (yColumn != nullptr)
+        && decompressDoubles(xColumn->bytes, xColumn->count, x)
+        && decompressDoubles(yColumn->bytes, yColumn->count, y)) {
+        auto count = std::min(x.size(), y.size());
+        auto resolution = toSizeT(pInfo[3]);
+
+        x.resize(count);
+        y.resize(count);
+
+        if ((resolution != 0) && (count > 2 * resolution)) {
+            auto indices = isMonotonic(x, count) ? decimatedIndices(y, count, resolution) : stridedIndices(count, resolution);
+            std::vector<double> decimatedX;
+            std::vector<double> decimatedY;
+
+            decimatedX.reserve(indices.size());
+            decimatedY.reserve(indices.size());
+
+            for (auto index : indices) {
+                decimatedX.push_back(x[index]);
+                decimatedY.push_back(y[index]);
+            }
+
+            x = std::move(decimatedX);
+            y = std::move(decimatedY);
+        }
+    } else {
+        x.clear();
+        y.clear();
+    }
+
+    res.Set("x", doublesToNapiFloat64Array(env, x));
+    res.Set("y", doublesToNapiFloat64Array(env, y));
+
+    return res;
+}
+
+void runStoreRemove(const Napi::CallbackInfo &pInfo)
+{
+    envData(pInfo.Env()).storedRuns.erase(toSizeT(pInfo[0]));
+}
+
+napi_value runStoreStatistics(const Napi::CallbackInfo &pInfo)
+{
+    auto env = pInfo.Env();
+    auto &storedRuns = envData(env).storedRuns;
+    auto res = Napi::Object::New(env);
+    uint64_t rawBytes {0};
+    uint64_t compressedBytes {0};
+
+    for (const auto &storedRun : storedRuns) {
+        for (const auto &storedColumn : storedRun.second) {
+            rawBytes += storedColumn.count * sizeof(double);
+            compressedBytes += storedColumn.bytes.size();
+        }
+    }
+
+    res.Set("runCount", Napi::Number::New(env, static_cast<double>(storedRuns.size())));
+    res.Set("rawBytes", Napi::Number::New(env, static_cast<double>(rawBytes)));
+    res.Set("compressedBytes", Napi::Number::New(env, static_cast<double>(compressedBytes)));
+
+    return res;
+}
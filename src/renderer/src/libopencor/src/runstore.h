@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <napi.h>
+
+// A run stored in our run store, i.e. a set of columns, each of which is compressed independently.
+
+struct StoredColumn
+{
+    uint64_t count;
+    std::vector<uint8_t> bytes;
+};
+
+using StoredRun = std::vector<StoredColumn>;
+
+// RunStore API.
+
+napi_value runStoreAdd(const Napi::CallbackInfo &pInfo);
+napi_value runStoreTrace(const Napi::CallbackInfo &pInfo);
+void runStoreRemove(const Napi::CallbackInfo &pInfo);
+napi_value runStoreStatistics(const Napi::CallbackInfo &pInfo);
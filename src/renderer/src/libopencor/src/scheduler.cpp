@@ -0,0 +1,618 @@
+#include "budget.h"
+#include "common.h"
+#include "scheduler.h"
+
+#include <condition_variable>
+#include <libopencor>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+namespace {
+
+struct SedRunChange
+{
+    std::string componentName;
+    std::string variableName;
+    std::string newValue;
+};
+
+struct SedRunUniformTimeCourse
+{
+    double initialTime;
+    double outputStartTime;
+    double outputEndTime;
+    int numberOfSteps;
+};
+
+struct SedRunRequest
+{
+    size_t generation;
+    std::vector<SedRunChange> changes;
+    std::optional<SedRunUniformTimeCourse> uniformTimeCourse;
+    libOpenCOR::SolverOdePtr odeSolver;
+};
+
+libOpenCOR::SolverOdePtr odeSolverCopy(const libOpenCOR::SolverOdePtr &pOdeSolver)
+{
+    // Return a copy of the given ODE solver, so that our worker thread never gets to share it with JavaScript.
+
+    if (auto cvode = std::dynamic_pointer_cast<libOpenCOR::SolverCvode>(pOdeSolver)) {
+        auto res = libOpenCOR::SolverCvode::create();
+
+        res->setMaximumStep(cvode->maximumStep());
+        res->setMaximumNumberOfSteps(cvode->maximumNumberOfSteps());
+        res->setIntegrationMethod(cvode->integrationMethod());
+        res->setIterationType(cvode->iterationType());
+        res->setLinearSolver(cvode->linearSolver());
+        res->setPreconditioner(cvode->preconditioner());
+        res->setUpperHalfBandwidth(cvode->upperHalfBandwidth());
+        res->setLowerHalfBandwidth(cvode->lowerHalfBandwidth());
+        res->setRelativeTolerance(cvode->relativeTolerance());
+        res->setAbsoluteTolerance(cvode->absoluteTolerance());
+        res->setInterpolateSolution(cvode->interpolateSolution());
+
+        return res;
+    }
+
+    if (auto forwardEuler = std::dynamic_pointer_cast<libOpenCOR::SolverForwardEuler>(pOdeSolver)) {
+        auto res = libOpenCOR::SolverForwardEuler::create();
+
+        res->setStep(forwardEuler->step());
+
+        return res;
+    }
+
+    if (auto fourthOrderRungeKutta = std::dynamic_pointer_cast<libOpenCOR::SolverFourthOrderRungeKutta>(pOdeSolver)) {
+        auto res = libOpenCOR::SolverFourthOrderRungeKutta::create();
+
+        res->setStep(fourthOrderRungeKutta->step());
+
+        return res;
+    }
+
+    if (auto heun = std::dynamic_pointer_cast<libOpenCOR::SolverHeun>(pOdeSolver)) {
+        auto res = libOpenCOR::SolverHeun::create();
+
+        res->setStep(heun->step());
+
+        return res;
+    }
+
+    if (auto secondOrderRungeKutta = std::dynamic_pointer_cast<libOpenCOR::SolverSecondOrderRungeKutta>(pOdeSolver)) {
+        auto res = libOpenCOR::SolverSecondOrderRungeKutta::create();
+
+        res->setStep(secondOrderRungeKutta->step());
+
+        return res;
+    }
+
+    return nullptr;
+}
+
+libOpenCOR::SedDocumentPtr sedDocumentCopy(const libOpenCOR::SedDocumentPtr &pSedDocument,
+                                           const libOpenCOR::FilePtr &pModelFile)
+{
+    // Return a copy of the given SED-ML document, so that our worker thread gets the same simulation type, NLA solver,
+    // and algorithm parameters, or a SED-ML document for the given model if the given SED-ML document cannot be copied.
+    // Note: libOpenCOR cannot copy a SED-ML document, so we serialise it to a transient SED-ML file, which we create
+    //       from our copy and then have libOpenCOR's file manager unmanage. This must be done with libOpenCOR's file
+    //       manager locked. Our copy must use the given model file, or it would not be able to find our model files.
+
+    auto &fileManager = libOpenCOR::FileManager::instance();
+    auto path = pModelFile->path() + ".SedRunScheduler.sedml";
+
+    if (fileManager.file(path) == nullptr) {
+        auto serialisation = pSedDocument->serialise();
+        auto file = libOpenCOR::File::create(path, false);
+
+        file->setContents(std::vector<unsigned char>(serialisation.begin(), serialisation.end()));
+
+        auto res = libOpenCOR::SedDocument::create(file);
+
+        fileManager.unmanage(file);
+
+        if ((res->modelCount() != 0) && (res->model(0)->file() == pModelFile) && (res->simulationCount() != 0)) {
+            return res;
+        }
+    }
+
+    return libOpenCOR::SedDocument::create(pModelFile);
+}
+
+} // namespace
+
+// A latest-wins scheduler for the runs of a SED-ML document.
+// Note: a run request replaces any request that is still pending, and it stops the run that is currently in progress
+//       (libOpenCOR checks for a stop request after each solver step). So, there is at most one run in progress and
+//       one run queued, and JavaScript only gets notified about the newest generation to have completed.
+//       libOpenCOR documents are not thread-safe, so our worker thread works on its own SED-ML document, which is a
+//       copy of the JavaScript one. Each request carries the model changes, the uniform time course settings, and (a
+//       copy of) the ODE solver of the JavaScript document, as they were when the request was made.
+//       Our worker thread keeps a reference to us, so that we can be released without waiting for it (it may be in
+//       the middle of instantiating a model, which cannot be interrupted). Only when our environment is being torn
+//       down do we wait for it to finish, after which our callback gets released straightaway, i.e. before Node-API
+//       finalises it. JavaScript only ever uses the instance that we last delivered, so that instance gets released
+//       (on the JavaScript thread) once we deliver a newer one or once we get released.
+
+class SedRunScheduler : public std::enable_shared_from_this<SedRunScheduler>
+{
+public:
+    explicit SedRunScheduler(const EnvData &pEnvData, size_t pDocumentId,
+                             const libOpenCOR::SedDocumentPtr &pSedDocument,
+                             const std::optional<std::string> &pModelFiles, const Napi::ThreadSafeFunction &pCallback);
+    ~SedRunScheduler();
+
+    void start();
+    void stop(bool pWait);
+    void releaseCallback();
+    void releaseSedInstance(EnvData &pData);
+
+    size_t latestGeneration() const;
+
+    void requestRun(SedRunRequest &&pRequest);
+
+private:
+    const EnvData &mEnvData;
+    size_t mDocumentId;
+    libOpenCOR::SedDocumentPtr mSedDocument;
+    std::optional<std::string> mModelFiles;
+    Napi::ThreadSafeFunction mCallback;
+    std::optional<size_t> mSedInstanceId;
+
+    mutable std::mutex mMutex;
+    std::condition_variable mCondition;
+    std::optional<SedRunRequest> mPendingRequest;
+    libOpenCOR::SedInstancePtr mRunningSedInstance;
+    size_t mLatestGeneration {0};
+    bool mStopping {false};
+    bool mFinished {false};
+    std::condition_variable mFinishedCondition;
+    bool mCallbackReleased {false};
+
+    std::thread mThread;
+
+    bool isSuperseded() const;
+
+    void notify(size_t pGeneration, const libOpenCOR::SedInstancePtr &pSedInstance, ResultsCacheEntry &&pCacheEntry,
+                libOpenCOR::FilePtrs &&pNewFiles);
+
+    void run();
+};
+
+namespace {
+
+struct SedRunResult
+{
+    size_t documentId;
+    std::shared_ptr<SedRunScheduler> scheduler;
+    size_t generation;
+    libOpenCOR::SedInstancePtr sedInstance;
+    ResultsCacheEntry cacheEntry;
+    std::string modelPath;
+    libOpenCOR::FilePtrs newFiles;
+};
+
+} // namespace
+
+SedRunScheduler::SedRunScheduler(const EnvData &pEnvData, size_t pDocumentId,
+                                 const libOpenCOR::SedDocumentPtr &pSedDocument,
+                                 const std::optional<std::string> &pModelFiles, const Napi::ThreadSafeFunction &pCallback)
+    : mEnvData(pEnvData)
+    , mDocumentId(pDocumentId)
+    , mSedDocument(pSedDocument)
+    , mModelFiles(pModelFiles)
+    , mCallback(pCallback)
+{
+}
+
+SedRunScheduler::~SedRunScheduler()
+{
+    // Note: our worker thread keeps a reference to us, so by now it has been detached.
+
+    releaseCallback();
+}
+
+void SedRunScheduler::start()
+{
+    mThread = std::thread([self = shared_from_this()]() {
+        self->run();
+
+        std::lock_guard<std::mutex> lock(self->mMutex);
+
+        self->mFinished = true;
+
+        self->mFinishedCondition.notify_all();
+    });
+}
+
+void SedRunScheduler::stop(bool pWait)
+{
+    // Stop any run in progress and let our worker thread know that it should finish, waiting for it to do so if
+    // requested (i.e. when our environment is being torn down).
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        mStopping = true;
+
+        if (mRunningSedInstance != nullptr) {
+            mRunningSedInstance->stopRun();
+        }
+    }
+
+    mCondition.notify_one();
+
+    if (mThread.joinable()) {
+        mThread.detach();
+    }
+
+    if (pWait) {
+        std::unique_lock<std::mutex> lock(mMutex);
+
+        mFinishedCondition.wait(lock, [this] {
+            return mFinished;
+        });
+    }
+}
+
+void SedRunScheduler::releaseCallback()
+{
+    // Release our callback, unless it has already been released (i.e. when our environment was torn down).
+
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    if (!mCallbackReleased) {
+        mCallback.Release();
+
+        mCallbackReleased = true;
+    }
+}
+
+void SedRunScheduler::releaseSedInstance(EnvData &pData)
+{
+    // Release the instance that we last delivered, if any.
+    // Note: this must be called on the JavaScript thread.
+
+    if (mSedInstanceId.has_value()) {
+        sedInstanceRelease(pData, *mSedInstanceId);
+
+        mSedInstanceId.reset();
+    }
+}
+
+size_t SedRunScheduler::latestGeneration() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    return mLatestGeneration;
+}
+
+void SedRunScheduler::requestRun(SedRunRequest &&pRequest)
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        mLatestGeneration = pRequest.generation;
+        mPendingRequest = std::move(pRequest);
+
+        if (mRunningSedInstance != nullptr) {
+            mRunningSedInstance->stopRun();
+        }
+    }
+
+    mCondition.notify_one();
+}
+
+bool SedRunScheduler::isSuperseded() const
+{
+    // Note: this must be called with our mutex locked.
+
+    return mStopping || mPendingRequest.has_value();
+}
+
+void SedRunScheduler::notify(size_t pGeneration, const libOpenCOR::SedInstancePtr &pSedInstance,
+                             ResultsCacheEntry &&pCacheEntry, libOpenCOR::FilePtrs &&pNewFiles)
+{
+    // Let JavaScript know about our completed run (or the results we got from our results cache), if any, and about
+    // the files that libOpenCOR's file manager started managing on our behalf, if any.
+    // Note: the instance only gets registered on the JavaScript thread and only if no newer request has come in since,
+    //       which means that superseded instances never get an ID and get released straightaway.
+
+    auto result = new SedRunResult {mDocumentId, shared_from_this(), pGeneration, pSedInstance, std::move(pCacheEntry),
+                                    sedDocumentModelPath(mSedDocument), std::move(pNewFiles)};
+    auto status = mCallback.NonBlockingCall(result, [](Napi::Env pEnv, Napi::Function pCallback, SedRunResult *pResult) {
+        std::unique_ptr<SedRunResult> result(pResult);
+
+        if (pEnv == nullptr) {
+            return;
+        }
+
+        addFiles(envData(pEnv), result->modelPath, result->newFiles);
+
+        auto &sedRunSchedulers = envData(pEnv).sedRunSchedulers;
+        auto scheduler = sedRunSchedulers.find(result->documentId);
+
+        if (((result->sedInstance == nullptr) && (result->cacheEntry.results == nullptr))
+            || (scheduler == sedRunSchedulers.end())
+            || (scheduler->second != result->scheduler)
+            || (scheduler->second->latestGeneration() != result->generation)) {
+            return;
+        }
+
+        auto instanceId = (result->sedInstance != nullptr) ? addSedInstance(pEnv, result->sedInstance) : addCachedSedInstance(pEnv, result->cacheEntry);
+
+        result->scheduler->releaseSedInstance(envData(pEnv));
+        result->scheduler->mSedInstanceId = instanceId;
+
+        sedInstanceTouch(pEnv, instanceId);
+
+        pCallback.Call({Napi::Number::New(pEnv, static_cast<double>(result->generation)),
+                        Napi::Number::New(pEnv, static_cast<double>(instanceId))});
+    });
+
+    if (status != napi_ok) {
+        delete result;
+    }
+}
+
+void SedRunScheduler::run()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+
+    for (;;) {
+        mCondition.wait(lock, [this] {
+            return mStopping || mPendingRequest.has_value();
+        });
+
+        if (mStopping) {
+            break;
+        }
+
+        // Apply the latest request to our SED-ML document and use our cached results, if available, or instantiate our
+        // SED-ML document otherwise.
+        // Note: instantiating a model may result in libOpenCOR's file manager managing new files (e.g. imported ones).
+
+        auto request = std::move(*mPendingRequest);
+
+        mPendingRequest.reset();
+
+        lock.unlock();
+
+        auto model = mSedDocument->model(0);
+        auto simulation = mSedDocument->simulation(0);
+        auto uniformTimeCourse = std::dynamic_pointer_cast<libOpenCOR::SedUniformTimeCourse>(simulation);
+
+        model->removeAllChanges();
+
+        for (const auto &change : request.changes) {
+            model->addChange(libOpenCOR::SedChangeAttribute::create(change.componentName,
+                                                                    change.variableName,
+                                                                    change.newValue));
+        }
+
+        if ((uniformTimeCourse != nullptr) && request.uniformTimeCourse.has_value()) {
+            uniformTimeCourse->setInitialTime(request.uniformTimeCourse->initialTime);
+            uniformTimeCourse->setOutputStartTime(request.uniformTimeCourse->outputStartTime);
+            uniformTimeCourse->setOutputEndTime(request.uniformTimeCourse->outputEndTime);
+            uniformTimeCourse->setNumberOfSteps(request.uniformTimeCourse->numberOfSteps);
+        }
+
+        if (request.odeSolver != nullptr) {
+            simulation->setOdeSolver(request.odeSolver);
+        }
+
+        ResultsCacheKey cacheKey;
+
+        if (mModelFiles.has_value()) {
+            cacheKey = resultsCacheKey(mSedDocument, *mModelFiles);
+
+            auto cacheEntry = resultsCacheLoad(cacheKey);
+
+            if (cacheEntry.results != nullptr) {
+                lock.lock();
+
+                if (!isSuperseded()) {
+                    notify(request.generation, nullptr, std::move(cacheEntry), {});
+                }
+
+                continue;
+            }
+        }
+
+        libOpenCOR::FilePtrs newFiles;
+        auto sedInstance = instantiateSedDocument(mEnvData, mSedDocument, newFiles);
+
+        lock.lock();
+
+        if (isSuperseded()) {
+            if (!newFiles.empty()) {
+                notify(request.generation, nullptr, {}, std::move(newFiles));
+            }
+
+            continue;
+        }
+
+        // Run the simulation and wait for it to complete or to be stopped by a newer request.
+        // Note: a newer request may have come in between us releasing our lock and the run starting, in which case
+        //       requestRun() will have had nothing to stop, hence we check again once the run has started.
+
+        mRunningSedInstance = sedInstance;
+
+        lock.unlock();
+
+        if (sedInstance->startRun()) {
+            {
+                std::lock_guard<std::mutex> runLock(mMutex);
+
+                if (isSuperseded()) {
+                    sedInstance->stopRun();
+                }
+            }
+
+            sedInstance->waitForRun();
+        }
+
+        lock.lock();
+
+        mRunningSedInstance = nullptr;
+
+        // Cache the results of our run if it completed, i.e. if it wasn't stopped by a newer request.
+
+        auto completed = !isSuperseded();
+
+        lock.unlock();
+
+        if (completed && !sedInstance->hasIssues()) {
+            resultsCacheStore(cacheKey, sedInstance);
+        }
+
+        lock.lock();
+
+        if (!isSuperseded()) {
+            notify(request.generation, sedInstance, {}, std::move(newFiles));
+        } else if (!newFiles.empty()) {
+            notify(request.generation, nullptr, {}, std::move(newFiles));
+        }
+    }
+}
+
+void stopSedRunSchedulers(EnvData &pData)
+{
+    // Our environment is being torn down, so wait for the worker threads of all our run schedulers to finish,
+    // including those of our released run schedulers since they refer to our environment, and release their callback.
+
+    std::vector<std::shared_ptr<SedRunScheduler>> sedRunSchedulers;
+
+    for (const auto &sedRunScheduler : pData.sedRunSchedulers) {
+        sedRunSchedulers.push_back(sedRunScheduler.second);
+    }
+
+    for (const auto &releasedSedRunScheduler : pData.releasedSedRunSchedulers) {
+        if (auto sedRunScheduler = releasedSedRunScheduler.lock()) {
+            sedRunSchedulers.push_back(sedRunScheduler);
+        }
+    }
+
+    for (const auto &sedRunScheduler : sedRunSchedulers) {
+        sedRunScheduler->stop(true);
+        sedRunScheduler->releaseCallback();
+    }
+
+    pData.sedRunSchedulers.clear();
+    pData.releasedSedRunSchedulers.clear();
+}
+
+namespace {
+
+void releaseSedRunScheduler(EnvData &pData, size_t pDocumentId)
+{
+    // Release the run scheduler of the given document, if any, without waiting for its worker thread to finish, so as
+    // not to block JavaScript.
+
+    auto scheduler = pData.sedRunSchedulers.find(pDocumentId);
+
+    if (scheduler == pData.sedRunSchedulers.end()) {
+        return;
+    }
+
+    scheduler->second->stop(false);
+    scheduler->second->releaseSedInstance(pData);
+
+    std::erase_if(pData.releasedSedRunSchedulers, [](const auto &pReleasedSedRunScheduler) {
+        return pReleasedSedRunScheduler.expired();
+    });
+
+    pData.releasedSedRunSchedulers.push_back(scheduler->second);
+    pData.sedRunSchedulers.erase(scheduler);
+}
+
+} // namespace
+
+// SedRunScheduler API.
+
+void sedRunSchedulerCreate(const Napi::CallbackInfo &pInfo)
+{
+    auto documentId = toSizeT(pInfo[0]);
+    auto callback = Napi::ThreadSafeFunction::New(pInfo.Env(), pInfo[1].As<Napi::Function>(), "SedRunScheduler", 0, 1);
+
+    // Don't let our callback keep the event loop alive, and make sure that we can release it when our environment is
+    // being torn down.
+
+    callback.Unref(pInfo.Env());
+
+    keepCleanupHookFirst(pInfo.Env());
+
+    // Create the SED-ML document of our scheduler, as a copy of the given SED-ML document, and retrieve its model
+    // files, so that our worker thread can look up our results cache (if it is enabled at this stage).
+    // Note: creating a SED-ML document may result in libOpenCOR's file manager managing new files.
+
+    auto &data = envData(pInfo.Env());
+    auto jsSedDocument = toSedDocument(pInfo[0]);
+    auto modelFile = jsSedDocument->model(0)->file();
+    libOpenCOR::SedDocumentPtr sedDocument;
+    libOpenCOR::FilePtrs newFiles;
+
+    {
+        FileManagerLock lock(data);
+
+        sedDocument = sedDocumentCopy(jsSedDocument, modelFile);
+        newFiles = lock.newFiles(modelFile->path());
+    }
+
+    addFiles(data, modelFile->path(), newFiles);
+
+    auto modelFiles = resultsCacheModelFiles(data, sedDocument);
+
+    releaseSedRunScheduler(data, documentId);
+
+    auto scheduler = std::make_shared<SedRunScheduler>(data, documentId, sedDocument, modelFiles, callback);
+
+    scheduler->start();
+
+    data.sedRunSchedulers[documentId] = scheduler;
+}
+
+void sedRunSchedulerRequestRun(const Napi::CallbackInfo &pInfo)
+{
+    auto &sedRunSchedulers = envData(pInfo.Env()).sedRunSchedulers;
+    auto scheduler = sedRunSchedulers.find(toSizeT(pInfo[0]));
+
+    if (scheduler == sedRunSchedulers.end()) {
+        return;
+    }
+
+    auto changes = pInfo[2].As<Napi::Array>();
+    SedRunRequest request {toSizeT(pInfo[1]), {}, {}, {}};
+
+    request.changes.reserve(changes.Length());
+
+    for (uint32_t i = 0; i < changes.Length(); ++i) {
+        auto change = changes.Get(i).As<Napi::Object>();
+
+        request.changes.push_back({toString(change.Get("componentName")),
+                                   toString(change.Get("variableName")),
+                                   toString(change.Get("newValue"))});
+    }
+
+    // Take a snapshot of the simulation settings of the JavaScript document.
+
+    auto simulation = toSedDocument(pInfo[0])->simulation(0);
+
+    if (auto uniformTimeCourse = std::dynamic_pointer_cast<libOpenCOR::SedUniformTimeCourse>(simulation)) {
+        request.uniformTimeCourse = SedRunUniformTimeCourse {uniformTimeCourse->initialTime(),
+                                                             uniformTimeCourse->outputStartTime(),
+                                                             uniformTimeCourse->outputEndTime(),
+                                                             uniformTimeCourse->numberOfSteps()};
+    }
+
+    request.odeSolver = odeSolverCopy(simulation->odeSolver());
+
+    scheduler->second->requestRun(std::move(request));
+}
+
+void sedRunSchedulerRelease(const Napi::CallbackInfo &pInfo)
+{
+    releaseSedRunScheduler(envData(pInfo.Env()), toSizeT(pInfo[0]));
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <napi.h>
+
+struct EnvData;
+
+void stopSedRunSchedulers(EnvData &pData);
+
+// SedRunScheduler API.
+
+void sedRunSchedulerCreate(const Napi::CallbackInfo &pInfo);
+void sedRunSchedulerRequestRun(const Napi::CallbackInfo &pInfo);
+void sedRunSchedulerRelease(const Napi::CallbackInfo &pInfo);
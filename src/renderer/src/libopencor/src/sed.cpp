@@ -2,60 +2,110 @@
 #include "sed.h"
 
 #include <libopencor>
+#include <optional>
 
 // SedDocument API.
 
 napi_value sedDocumentCreate(const Napi::CallbackInfo &pInfo)
 {
-    static size_t documentId {std::numeric_limits<std::size_t>::max()};
+    // Use the SED-ML document that was created when the given file was opened asynchronously, if it hasn't been used
+    // yet, or create one otherwise.
+    // Note: a SED-ML document can only be used once, since different views must not share the same SED-ML document.
+
+    auto path = pInfo[0].ToString().Utf8Value();
+    auto &data = envData(pInfo.Env());
+    auto openedSedDocument = data.openedSedDocuments.find(path);
+
+    if (openedSedDocument != data.openedSedDocuments.end()) {
+        auto id = addSedDocument(pInfo.Env(), openedSedDocument->second);
+
+        data.openedSedDocuments.erase(openedSedDocument);
+
+        return Napi::Number::New(pInfo.Env(), static_cast<double>(id));
+    }
 
-    auto id = ++documentId;
     auto file = toFile(pInfo[0]);
-    auto sedDocument = libOpenCOR::SedDocument::create(file);
+    libOpenCOR::SedDocumentPtr sedDocument;
+    libOpenCOR::FilePtrs newFiles;
+
+    {
+        // Note: creating a SED-ML document may result in libOpenCOR's file manager managing new files.
 
-    sedDocuments[id] = sedDocument;
+        FileManagerLock lock(data);
+
+        sedDocument = libOpenCOR::SedDocument::create(file);
+        newFiles = lock.newFiles(path);
+    }
+
+    addFiles(data, path, newFiles);
+
+    auto id = addSedDocument(pInfo.Env(), sedDocument);
 
     return Napi::Number::New(pInfo.Env(), static_cast<double>(id));
 }
 
 napi_value sedDocumentInstantiate(const Napi::CallbackInfo &pInfo)
 {
-    static size_t instanceId {std::numeric_limits<std::size_t>::max()};
+    // Use our cached results, if available, in which case there is no need to instantiate (i.e. analyse and compile)
+    // the model, let alone run the simulation. Otherwise, instantiate the SED-ML document and have the
+    // results of its instance cached once its run has completed.
+
+    auto sedDocument = toSedDocument(pInfo[0]);
+    auto &data = envData(pInfo.Env());
+    auto modelFiles = resultsCacheModelFiles(data, sedDocument);
+    ResultsCacheKey cacheKey;
+
+    if (modelFiles.has_value()) {
+        cacheKey = resultsCacheKey(sedDocument, *modelFiles);
 
-    auto id = ++instanceId;
-    auto sedDocument = toSedDocument(toSizeT(pInfo[0]));
-    auto sedInstance = sedDocument->instantiate();
+        auto cacheEntry = resultsCacheLoad(cacheKey);
 
-    sedInstances[id] = sedInstance;
+        if (cacheEntry.results != nullptr) {
+            auto id = addCachedSedInstance(pInfo.Env(), cacheEntry);
+
+            return Napi::Number::New(pInfo.Env(), static_cast<double>(id));
+        }
+    }
+
+    libOpenCOR::FilePtrs newFiles;
+    auto sedInstance = instantiateSedDocument(data, sedDocument, newFiles);
+
+    addFiles(data, sedDocumentModelPath(sedDocument), newFiles);
+
+    auto id = addSedInstance(pInfo.Env(), sedInstance);
+
+    if (!cacheKey.name.empty()) {
+        data.sedInstanceCacheKeys[id] = cacheKey;
+    }
 
     return Napi::Number::New(pInfo.Env(), static_cast<double>(id));
 }
 
 napi_value sedDocumentIssues(const Napi::CallbackInfo &pInfo)
 {
-    return issues(pInfo, toSedDocument(toSizeT(pInfo[0]))->issues());
+    return issues(pInfo, toSedDocument(pInfo[0])->issues());
 }
 
 napi_value sedDocumentModelCount(const Napi::CallbackInfo &pInfo)
 {
-    return Napi::Number::New(pInfo.Env(), toSedDocument(toSizeT(pInfo[0]))->modelCount());
+    return Napi::Number::New(pInfo.Env(), toSedDocument(pInfo[0])->modelCount());
 }
 
 napi_value sedDocumentSimulationCount(const Napi::CallbackInfo &pInfo)
 {
-    return Napi::Number::New(pInfo.Env(), toSedDocument(toSizeT(pInfo[0]))->simulationCount());
+    return Napi::Number::New(pInfo.Env(), toSedDocument(pInfo[0])->simulationCount());
 }
 
 napi_value sedDocumentSerialise(const Napi::CallbackInfo &pInfo)
 {
-    auto sedDocument = toSedDocument(toSizeT(pInfo[0]));
+    auto sedDocument = toSedDocument(pInfo[0]);
 
     return Napi::String::New(pInfo.Env(), sedDocument->serialise());
 }
 
 napi_value sedDocumentSimulationType(const Napi::CallbackInfo &pInfo)
 {
-    auto sedDocument = toSedDocument(toSizeT(pInfo[0]));
+    auto sedDocument = toSedDocument(pInfo[0]);
     auto simulation = sedDocument->simulation(toInt32(pInfo[1]));
 
     if (std::dynamic_pointer_cast<libOpenCOR::SedAnalysis>(simulation) != nullptr) {
@@ -77,7 +127,7 @@ napi_value sedDocumentSimulationType(const Napi::CallbackInfo &pInfo)
 
 napi_value sedModelFilePath(const Napi::CallbackInfo &pInfo)
 {
-    auto sedDocument = toSedDocument(toSizeT(pInfo[0]));
+    auto sedDocument = toSedDocument(pInfo[0]);
     auto model = sedDocument->model(toInt32(pInfo[1]));
 
     return Napi::String::New(pInfo.Env(), model->file()->path());
@@ -85,7 +135,7 @@ napi_value sedModelFilePath(const Napi::CallbackInfo &pInfo)
 
 void sedModelAddChange(const Napi::CallbackInfo &pInfo)
 {
-    auto sedDocument = toSedDocument(toSizeT(pInfo[0]));
+    auto sedDocument = toSedDocument(pInfo[0]);
     auto model = sedDocument->model(toInt32(pInfo[1]));
     auto changeAttribute = libOpenCOR::SedChangeAttribute::create(toString(pInfo[2]),
                                                                   toString(pInfo[3]),
@@ -96,7 +146,7 @@ void sedModelAddChange(const Napi::CallbackInfo &pInfo)
 
 void sedModelRemoveAllChanges(const Napi::CallbackInfo &pInfo)
 {
-    auto sedDocument = toSedDocument(toSizeT(pInfo[0]));
+    auto sedDocument = toSedDocument(pInfo[0]);
     auto model = sedDocument->model(toInt32(pInfo[1]));
 
     model->removeAllChanges();
@@ -106,7 +156,7 @@ void sedModelRemoveAllChanges(const Napi::CallbackInfo &pInfo)
 
 napi_value sedOneStepStep(const Napi::CallbackInfo &pInfo)
 {
-    auto sedDocument = toSedDocument(toSizeT(pInfo[0]));
+    auto sedDocument = toSedDocument(pInfo[0]);
     auto simulation = sedDocument->simulation(toInt32(pInfo[1]));
     auto oneStep = std::dynamic_pointer_cast<libOpenCOR::SedOneStep>(simulation);
 
@@ -117,7 +167,7 @@ napi_value sedOneStepStep(const Napi::CallbackInfo &pInfo)
 
 napi_value sedUniformTimeCourseInitialTime(const Napi::CallbackInfo &pInfo)
 {
-    auto sedDocument = toSedDocument(toSizeT(pInfo[0]));
+    auto sedDocument = toSedDocument(pInfo[0]);
     auto simulation = sedDocument->simulation(toInt32(pInfo[1]));
     auto uniformTimeCourse = std::dynamic_pointer_cast<libOpenCOR::SedUniformTimeCourse>(simulation);
 
@@ -126,7 +176,7 @@ napi_value sedUniformTimeCourseInitialTime(const Napi::CallbackInfo &pInfo)
 
 void sedUniformTimeCourseSetInitialTime(const Napi::CallbackInfo &pInfo)
 {
-    auto sedDocument = toSedDocument(toSizeT(pInfo[0]));
+    auto sedDocument = toSedDocument(pInfo[0]);
     auto simulation = sedDocument->simulation(toInt32(pInfo[1]));
     auto uniformTimeCourse = std::dynamic_pointer_cast<libOpenCOR::SedUniformTimeCourse>(simulation);
 
@@ -135,7 +185,7 @@ void sedUniformTimeCourseSetInitialTime(const Napi::CallbackInfo &pInfo)
 
 napi_value sedUniformTimeCourseOutputStartTime(const Napi::CallbackInfo &pInfo)
 {
-    auto sedDocument = toSedDocument(toSizeT(pInfo[0]));
+    auto sedDocument = toSedDocument(pInfo[0]);
     auto simulation = sedDocument->simulation(toInt32(pInfo[1]));
     auto uniformTimeCourse = std::dynamic_pointer_cast<libOpenCOR::SedUniformTimeCourse>(simulation);
 
@@ -144,7 +194,7 @@ napi_value sedUniformTimeCourseOutputStartTime(const Napi::CallbackInfo &pInfo)
 
 void sedUniformTimeCourseSetOutputStartTime(const Napi::CallbackInfo &pInfo)
 {
-    auto sedDocument = toSedDocument(toSizeT(pInfo[0]));
+    auto sedDocument = toSedDocument(pInfo[0]);
     auto simulation = sedDocument->simulation(toInt32(pInfo[1]));
     auto uniformTimeCourse = std::dynamic_pointer_cast<libOpenCOR::SedUniformTimeCourse>(simulation);
 
@@ -153,7 +203,7 @@ void sedUniformTimeCourseSetOutputStartTime(const Napi::CallbackInfo &pInfo)
 
 napi_value sedUniformTimeCourseOutputEndTime(const Napi::CallbackInfo &pInfo)
 {
-    auto sedDocument = toSedDocument(toSizeT(pInfo[0]));
+    auto sedDocument = toSedDocument(pInfo[0]);
     auto simulation = sedDocument->simulation(toInt32(pInfo[1]));
     auto uniformTimeCourse = std::dynamic_pointer_cast<libOpenCOR::SedUniformTimeCourse>(simulation);
 
@@ -162,7 +212,7 @@ napi_value sedUniformTimeCourseOutputEndTime(const Napi::CallbackInfo &pInfo)
 
 void sedUniformTimeCourseSetOutputEndTime(const Napi::CallbackInfo &pInfo)
 {
-    auto sedDocument = toSedDocument(toSizeT(pInfo[0]));
+    auto sedDocument = toSedDocument(pInfo[0]);
     auto simulation = sedDocument->simulation(toInt32(pInfo[1]));
     auto uniformTimeCourse = std::dynamic_pointer_cast<libOpenCOR::SedUniformTimeCourse>(simulation);
 
@@ -171,7 +221,7 @@ void sedUniformTimeCourseSetOutputEndTime(const Napi::CallbackInfo &pInfo)
 
 napi_value sedUniformTimeCourseNumberOfSteps(const Napi::CallbackInfo &pInfo)
 {
-    auto sedDocument = toSedDocument(toSizeT(pInfo[0]));
+    auto sedDocument = toSedDocument(pInfo[0]);
     auto simulation = sedDocument->simulation(toInt32(pInfo[1]));
     auto uniformTimeCourse = std::dynamic_pointer_cast<libOpenCOR::SedUniformTimeCourse>(simulation);
 
@@ -180,281 +230,1008 @@ napi_value sedUniformTimeCourseNumberOfSteps(const Napi::CallbackInfo &pInfo)
 
 void sedUniformTimeCourseSetNumberOfSteps(const Napi::CallbackInfo &pInfo)
 {
-    auto sedDocument = toSedDocument(toSizeT(pInfo[0]));
+    auto sedDocument = toSedDocument(pInfo[0]);
     auto simulation = sedDocument->simulation(toInt32(pInfo[1]));
     auto uniformTimeCourse = std::dynamic_pointer_cast<libOpenCOR::SedUniformTimeCourse>(simulation);
 
     uniformTimeCourse->setNumberOfSteps(toInt32(pInfo[2]));
 }
 
+// SedSimulation API.
+
+namespace {
+
+libOpenCOR::SedSimulationPtr toSedSimulation(const Napi::CallbackInfo &pInfo)
+{
+    auto sedDocument = toSedDocument(pInfo[0]);
+
+    return sedDocument->simulation(toInt32(pInfo[1]));
+}
+
+libOpenCOR::SolverCvodePtr toSolverCvode(const Napi::CallbackInfo &pInfo)
+{
+    return std::dynamic_pointer_cast<libOpenCOR::SolverCvode>(toSedSimulation(pInfo)->odeSolver());
+}
+
+std::optional<int> odeSolverType(const libOpenCOR::SolverOdePtr &pSolver)
+{
+    if (std::dynamic_pointer_cast<libOpenCOR::SolverCvode>(pSolver) != nullptr) {
+        return 0;
+    }
+
+    if (std::dynamic_pointer_cast<libOpenCOR::SolverForwardEuler>(pSolver) != nullptr) {
+        return 1;
+    }
+
+    if (std::dynamic_pointer_cast<libOpenCOR::SolverFourthOrderRungeKutta>(pSolver) != nullptr) {
+        return 2;
+    }
+
+    if (std::dynamic_pointer_cast<libOpenCOR::SolverHeun>(pSolver) != nullptr) {
+        return 3;
+    }
+
+    if (std::dynamic_pointer_cast<libOpenCOR::SolverSecondOrderRungeKutta>(pSolver) != nullptr) {
+        return 4;
+    }
+
+    return std::nullopt;
+}
+
+template<typename T>
+std::optional<T> toEnum(const Napi::Value &pValue, T pLastValue)
+{
+    // Note: we may be given any number, so we only accept the values of the given enumeration.
+
+    auto value = toInt32(pValue);
+
+    if ((value < 0) || (value > static_cast<int32_t>(pLastValue))) {
+        return std::nullopt;
+    }
+
+    return static_cast<T>(value);
+}
+
+} // namespace
+
+napi_value sedSimulationOdeSolverType(const Napi::CallbackInfo &pInfo)
+{
+    // Note: a simulation may have no ODE solver (e.g. a steady state simulation), in which case we return -1.
+
+    return Napi::Number::New(pInfo.Env(), odeSolverType(toSedSimulation(pInfo)->odeSolver()).value_or(-1));
+}
+
+void sedSimulationSetOdeSolverType(const Napi::CallbackInfo &pInfo)
+{
+    // Note: we ignore a type that is not a valid one, and we keep the current ODE solver if it is already of the
+    //       requested type, so as not to lose its settings.
+
+    auto simulation = toSedSimulation(pInfo);
+    auto type = toInt32(pInfo[2]);
+
+    if ((type < 0) || (type > 4) || (odeSolverType(simulation->odeSolver()) == type)) {
+        return;
+    }
+
+    switch (type) {
+    case 1:
+        simulation->setOdeSolver(libOpenCOR::SolverForwardEuler::create());
+
+        break;
+    case 2:
+        simulation->setOdeSolver(libOpenCOR::SolverFourthOrderRungeKutta::create());
+
+        break;
+    case 3:
+        simulation->setOdeSolver(libOpenCOR::SolverHeun::create());
+
+        break;
+    case 4:
+        simulation->setOdeSolver(libOpenCOR::SolverSecondOrderRungeKutta::create());
+
+        break;
+    default:
+        simulation->setOdeSolver(libOpenCOR::SolverCvode::create());
+    }
+}
+
 // SolverCvode API.
-// TODO: this is only temporary until we have full support for our different solvers.
+// Note: the getters return undefined if the ODE solver of the simulation is not CVODE while the setters do nothing.
+//       The setters of an enumeration also do nothing if they are given a value that is not part of it.
 
 napi_value solverCvodeMaximumStep(const Napi::CallbackInfo &pInfo)
 {
-    auto sedDocument = toSedDocument(toSizeT(pInfo[0]));
-    auto simulation = sedDocument->simulation(toInt32(pInfo[1]));
-    auto solver = std::dynamic_pointer_cast<libOpenCOR::SolverCvode>(simulation->odeSolver());
+    auto solver = toSolverCvode(pInfo);
+
+    if (solver == nullptr) {
+        return pInfo.Env().Undefined();
+    }
 
     return Napi::Number::New(pInfo.Env(), solver->maximumStep());
 }
 
 void solverCvodeSetMaximumStep(const Napi::CallbackInfo &pInfo)
 {
-    auto sedDocument = toSedDocument(toSizeT(pInfo[0]));
-    auto simulation = sedDocument->simulation(toInt32(pInfo[1]));
-    auto solver = std::dynamic_pointer_cast<libOpenCOR::SolverCvode>(simulation->odeSolver());
+    auto solver = toSolverCvode(pInfo);
+
+    if (solver != nullptr) {
+        solver->setMaximumStep(toDouble(pInfo[2]));
+    }
+}
+
+napi_value solverCvodeMaximumNumberOfSteps(const Napi::CallbackInfo &pInfo)
+{
+    auto solver = toSolverCvode(pInfo);
+
+    if (solver == nullptr) {
+        return pInfo.Env().Undefined();
+    }
+
+    return Napi::Number::New(pInfo.Env(), solver->maximumNumberOfSteps());
+}
+
+void solverCvodeSetMaximumNumberOfSteps(const Napi::CallbackInfo &pInfo)
+{
+    auto solver = toSolverCvode(pInfo);
+
+    if (solver != nullptr) {
+        solver->setMaximumNumberOfSteps(toInt32(pInfo[2]));
+    }
+}
+
+napi_value solverCvodeIntegrationMethod(const Napi::CallbackInfo &pInfo)
+{
+    auto solver = toSolverCvode(pInfo);
+
+    if (solver == nullptr) {
+        return pInfo.Env().Undefined();
+    }
+
+    return Napi::Number::New(pInfo.Env(), static_cast<int>(solver->integrationMethod()));
+}
+
+void solverCvodeSetIntegrationMethod(const Napi::CallbackInfo &pInfo)
+{
+    auto solver = toSolverCvode(pInfo);
+    auto value = toEnum(pInfo[2], libOpenCOR::SolverCvode::IntegrationMethod::BDF);
+
+    if ((solver != nullptr) && value.has_value()) {
+        solver->setIntegrationMethod(*value);
+    }
+}
+
+napi_value solverCvodeIterationType(const Napi::CallbackInfo &pInfo)
+{
+    auto solver = toSolverCvode(pInfo);
+
+    if (solver == nullptr) {
+        return pInfo.Env().Undefined();
+    }
+
+    return Napi::Number::New(pInfo.Env(), static_cast<int>(solver->iterationType()));
+}
+
+void solverCvodeSetIterationType(const Napi::CallbackInfo &pInfo)
+{
+    auto solver = toSolverCvode(pInfo);
+    auto value = toEnum(pInfo[2], libOpenCOR::SolverCvode::IterationType::NEWTON);
+
+    if ((solver != nullptr) && value.has_value()) {
+        solver->setIterationType(*value);
+    }
+}
+
+napi_value solverCvodeLinearSolver(const Napi::CallbackInfo &pInfo)
+{
+    auto solver = toSolverCvode(pInfo);
+
+    if (solver == nullptr) {
+        return pInfo.Env().Undefined();
+    }
+
+    return Napi::Number::New(pInfo.Env(), static_cast<int>(solver->linearSolver()));
+}
+
+void solverCvodeSetLinearSolver(const Napi::CallbackInfo &pInfo)
+{
+    auto solver = toSolverCvode(pInfo);
+    auto value = toEnum(pInfo[2], libOpenCOR::SolverCvode::LinearSolver::TFQMR);
+
+    if ((solver != nullptr) && value.has_value()) {
+        solver->setLinearSolver(*value);
+    }
+}
+
+napi_value solverCvodePreconditioner(const Napi::CallbackInfo &pInfo)
+{
+    auto solver = toSolverCvode(pInfo);
+
+    if (solver == nullptr) {
+        return pInfo.Env().Undefined();
+    }
+
+    return Napi::Number::New(pInfo.Env(), static_cast<int>(solver->preconditioner()));
+}
+
+void solverCvodeSetPreconditioner(const Napi::CallbackInfo &pInfo)
+{
+    auto solver = toSolverCvode(pInfo);
+    auto value = toEnum(pInfo[2], libOpenCOR::SolverCvode::Preconditioner::BANDED);
+
+    if ((solver != nullptr) && value.has_value()) {
+        solver->setPreconditioner(*value);
+    }
+}
+
+napi_value solverCvodeUpperHalfBandwidth(const Napi::CallbackInfo &pInfo)
+{
+    auto solver = toSolverCvode(pInfo);
+
+    if (solver == nullptr) {
+        return pInfo.Env().Undefined();
+    }
+
+    return Napi::Number::New(pInfo.Env(), solver->upperHalfBandwidth());
+}
+
+void solverCvodeSetUpperHalfBandwidth(const Napi::CallbackInfo &pInfo)
+{
+    auto solver = toSolverCvode(pInfo);
+
+    if (solver != nullptr) {
+        solver->setUpperHalfBandwidth(toInt32(pInfo[2]));
+    }
+}
+
+napi_value solverCvodeLowerHalfBandwidth(const Napi::CallbackInfo &pInfo)
+{
+    auto solver = toSolverCvode(pInfo);
+
+    if (solver == nullptr) {
+        return pInfo.Env().Undefined();
+    }
+
+    return Napi::Number::New(pInfo.Env(), solver->lowerHalfBandwidth());
+}
+
+void solverCvodeSetLowerHalfBandwidth(const Napi::CallbackInfo &pInfo)
+{
+    auto solver = toSolverCvode(pInfo);
+
+    if (solver != nullptr) {
+        solver->setLowerHalfBandwidth(toInt32(pInfo[2]));
+    }
+}
+
+napi_value solverCvodeRelativeTolerance(const Napi::CallbackInfo &pInfo)
+{
+    auto solver = toSolverCvode(pInfo);
+
+    if (solver == nullptr) {
+        return pInfo.Env().Undefined();
+    }
+
+    return Napi::Number::New(pInfo.Env(), solver->relativeTolerance());
+}
+
+void solverCvodeSetRelativeTolerance(const Napi::CallbackInfo &pInfo)
+{
+    auto solver = toSolverCvode(pInfo);
+
+    if (solver != nullptr) {
+        solver->setRelativeTolerance(toDouble(pInfo[2]));
+    }
+}
+
+napi_value solverCvodeAbsoluteTolerance(const Napi::CallbackInfo &pInfo)
+{
+    auto solver = toSolverCvode(pInfo);
+
+    if (solver == nullptr) {
+        return pInfo.Env().Undefined();
+    }
+
+    return Napi::Number::New(pInfo.Env(), solver->absoluteTolerance());
+}
+
+void solverCvodeSetAbsoluteTolerance(const Napi::CallbackInfo &pInfo)
+{
+    auto solver = toSolverCvode(pInfo);
+
+    if (solver != nullptr) {
+        solver->setAbsoluteTolerance(toDouble(pInfo[2]));
+    }
+}
+
+napi_value solverCvodeInterpolateSolution(const Napi::CallbackInfo &pInfo)
+{
+    auto solver = toSolverCvode(pInfo);
+
+    if (solver == nullptr) {
+        return pInfo.Env().Undefined();
+    }
+
+    return Napi::Boolean::New(pInfo.Env(), solver->interpolateSolution());
+}
+
+void solverCvodeSetInterpolateSolution(const Napi::CallbackInfo &pInfo)
+{
+    auto solver = toSolverCvode(pInfo);
+
+    if (solver != nullptr) {
+        solver->setInterpolateSolution(pInfo[2].As<Napi::Boolean>().Value());
+    }
+}
+
+// SolverFixedStep API.
+// Note: this covers our fixed-step ODE solvers, i.e. forward Euler, fourth-order Runge-Kutta, Heun, and second-order
+//       Runge-Kutta. The getter returns undefined if the ODE solver of the simulation is not a fixed-step one while
+//       the setter does nothing.
+
+napi_value solverFixedStepStep(const Napi::CallbackInfo &pInfo)
+{
+    auto solver = toSedSimulation(pInfo)->odeSolver();
+
+    if (auto forwardEuler = std::dynamic_pointer_cast<libOpenCOR::SolverForwardEuler>(solver)) {
+        return Napi::Number::New(pInfo.Env(), forwardEuler->step());
+    }
+
+    if (auto fourthOrderRungeKutta = std::dynamic_pointer_cast<libOpenCOR::SolverFourthOrderRungeKutta>(solver)) {
+        return Napi::Number::New(pInfo.Env(), fourthOrderRungeKutta->step());
+    }
 
-    solver->setMaximumStep(toDouble(pInfo[2]));
+    if (auto heun = std::dynamic_pointer_cast<libOpenCOR::SolverHeun>(solver)) {
+        return Napi::Number::New(pInfo.Env(), heun->step());
+    }
+
+    if (auto secondOrderRungeKutta = std::dynamic_pointer_cast<libOpenCOR::SolverSecondOrderRungeKutta>(solver)) {
+        return Napi::Number::New(pInfo.Env(), secondOrderRungeKutta->step());
+    }
+
+    return pInfo.Env().Undefined();
+}
+
+void solverFixedStepSetStep(const Napi::CallbackInfo &pInfo)
+{
+    auto solver = toSedSimulation(pInfo)->odeSolver();
+    auto step = toDouble(pInfo[2]);
+
+    if (auto forwardEuler = std::dynamic_pointer_cast<libOpenCOR::SolverForwardEuler>(solver)) {
+        forwardEuler->setStep(step);
+    } else if (auto fourthOrderRungeKutta = std::dynamic_pointer_cast<libOpenCOR::SolverFourthOrderRungeKutta>(solver)) {
+        fourthOrderRungeKutta->setStep(step);
+    } else if (auto heun = std::dynamic_pointer_cast<libOpenCOR::SolverHeun>(solver)) {
+        heun->setStep(step);
+    } else if (auto secondOrderRungeKutta = std::dynamic_pointer_cast<libOpenCOR::SolverSecondOrderRungeKutta>(solver)) {
+        secondOrderRungeKutta->setStep(step);
+    }
 }
 
 // SedInstance API.
 
 napi_value sedInstanceHasIssues(const Napi::CallbackInfo &pInfo)
 {
-    auto sedInstance = toSedInstance(toSizeT(pInfo[0]));
+    auto sedInstance = toSedInstance(pInfo[0]);
+
+    if (sedInstance == nullptr) {
+        return Napi::Boolean::New(pInfo.Env(), false);
+    }
 
     return Napi::Boolean::New(pInfo.Env(), sedInstance->hasIssues());
 }
 
 napi_value sedInstanceIssues(const Napi::CallbackInfo &pInfo)
 {
-    auto sedInstance = toSedInstance(toSizeT(pInfo[0]));
+    auto sedInstance = toSedInstance(pInfo[0]);
+
+    if (sedInstance == nullptr) {
+        return issues(pInfo, {});
+    }
 
     return issues(pInfo, sedInstance->issues());
 }
 
 napi_value sedInstanceStatus(const Napi::CallbackInfo &pInfo)
 {
-    auto sedInstance = toSedInstance(toSizeT(pInfo[0]));
+    // Note: an instance which got released by our memory accounting had completed its run.
 
-    return Napi::Number::New(pInfo.Env(), static_cast<int>(sedInstance->status()));
+    auto id = toSizeT(pInfo[0]);
+    auto &data = envData(pInfo.Env());
+    auto sedInstance = toSedInstance(pInfo[0]);
+
+    if (data.sedInstanceCachedResults.contains(id) || (sedInstance == nullptr)) {
+        return Napi::Number::New(pInfo.Env(), 0); // Idle.
+    }
+
+    auto status = static_cast<int>(sedInstance->status());
+
+    // Cache the results of the instance if its run has just completed, and account for them.
+
+    if (status == 0) {
+        if (data.sedInstancesToCache.erase(id) && !sedInstance->hasIssues()) {
+            resultsCacheStore(data.sedInstanceCacheKeys[id], sedInstance);
+        }
+
+        sedInstanceTouch(pInfo.Env(), id);
+    }
+
+    return Napi::Number::New(pInfo.Env(), status);
 }
 
 napi_value sedInstanceProgress(const Napi::CallbackInfo &pInfo)
 {
-    auto sedInstance = toSedInstance(toSizeT(pInfo[0]));
+    auto sedInstance = toSedInstance(pInfo[0]);
+
+    if (envData(pInfo.Env()).sedInstanceCachedResults.contains(toSizeT(pInfo[0])) || (sedInstance == nullptr)) {
+        return Napi::Number::New(pInfo.Env(), 1.0);
+    }
 
     return Napi::Number::New(pInfo.Env(), sedInstance->progress());
 }
 
 napi_value sedInstanceStartRun(const Napi::CallbackInfo &pInfo)
 {
-    auto sedInstance = toSedInstance(toSizeT(pInfo[0]));
+    // Run the simulation and have its results cached once it has completed.
+    // Note: an instance which results come from our results cache has nothing to run, while an instance which got
+    //       released by our memory accounting cannot be run anymore.
+
+    auto id = toSizeT(pInfo[0]);
+    auto &data = envData(pInfo.Env());
+    auto sedInstance = toSedInstance(pInfo[0]);
+
+    if (sedInstance == nullptr) {
+        sedInstanceTouch(pInfo.Env(), id);
 
-    return Napi::Boolean::New(pInfo.Env(), sedInstance->startRun());
+        return Napi::Boolean::New(pInfo.Env(), data.sedInstanceCachedResults.contains(id));
+    }
+
+    sedInstanceResetMemory(pInfo.Env(), id);
+
+    auto res = sedInstance->startRun();
+
+    if (res && data.sedInstanceCacheKeys.contains(id)) {
+        data.sedInstancesToCache.insert(id);
+    }
+
+    return Napi::Boolean::New(pInfo.Env(), res);
 }
 
 napi_value sedInstanceWaitForRun(const Napi::CallbackInfo &pInfo)
 {
-    auto sedInstance = toSedInstance(toSizeT(pInfo[0]));
+    auto id = toSizeT(pInfo[0]);
+    auto &data = envData(pInfo.Env());
+    auto sedInstance = toSedInstance(pInfo[0]);
+
+    if (data.sedInstanceCachedResults.contains(id) || (sedInstance == nullptr)) {
+        return Napi::Number::New(pInfo.Env(), 0.0);
+    }
+
+    auto res = sedInstance->waitForRun();
+
+    if (data.sedInstancesToCache.erase(id) && !sedInstance->hasIssues()) {
+        resultsCacheStore(data.sedInstanceCacheKeys[id], sedInstance);
+    }
+
+    sedInstanceTouch(pInfo.Env(), id);
 
-    return Napi::Number::New(pInfo.Env(), sedInstance->waitForRun());
+    return Napi::Number::New(pInfo.Env(), res);
 }
 
 void sedInstancePauseRun(const Napi::CallbackInfo &pInfo)
 {
-    auto sedInstance = toSedInstance(toSizeT(pInfo[0]));
+    auto sedInstance = toSedInstance(pInfo[0]);
 
-    sedInstance->pauseRun();
+    if (sedInstance != nullptr) {
+        sedInstance->pauseRun();
+    }
 }
 
 void sedInstanceResumeRun(const Napi::CallbackInfo &pInfo)
 {
-    auto sedInstance = toSedInstance(toSizeT(pInfo[0]));
+    auto sedInstance = toSedInstance(pInfo[0]);
 
-    sedInstance->resumeRun();
+    if (sedInstance != nullptr) {
+        sedInstance->resumeRun();
+    }
 }
 
 void sedInstanceStopRun(const Napi::CallbackInfo &pInfo)
 {
-    auto sedInstance = toSedInstance(toSizeT(pInfo[0]));
+    // Results of a stopped run are incomplete, so they must not be cached.
+
+    envData(pInfo.Env()).sedInstancesToCache.erase(toSizeT(pInfo[0]));
+
+    auto sedInstance = toSedInstance(pInfo[0]);
+
+    if (sedInstance != nullptr) {
+        sedInstance->stopRun();
+    }
+}
+
+napi_value sedInstanceResultBytes(const Napi::CallbackInfo &pInfo)
+{
+    // Return the number of bytes used by the results of the given instance, as accounted for by our memory accounting.
+
+    auto &sedInstanceMemory = envData(pInfo.Env()).sedInstanceMemory;
+    auto memory = sedInstanceMemory.find(toSizeT(pInfo[0]));
+
+    if (memory == sedInstanceMemory.end()) {
+        return Napi::Number::New(pInfo.Env(), 0.0);
+    }
 
-    sedInstance->stopRun();
+    return Napi::Number::New(pInfo.Env(), static_cast<double>(memory->second.bytes.value_or(0)));
 }
 
 // SedInstanceTask API.
+// Note: we may be given any task or variable index, so our getters check them and return an empty name, unit, or
+//       array if they are out of range (or if the instance got released by our memory accounting without keeping
+//       track of the names and units of its variables).
+
+namespace {
+
+std::optional<size_t> toIndex(const Napi::Value &pValue, size_t pCount)
+{
+    auto index = toInt32(pValue);
+
+    if ((index < 0) || (static_cast<size_t>(index) >= pCount)) {
+        return std::nullopt;
+    }
+
+    return static_cast<size_t>(index);
+}
+
+template<typename T>
+const T *toElement(const std::vector<T> &pVector, const Napi::Value &pValue)
+{
+    auto index = toIndex(pValue, pVector.size());
+
+    return index.has_value() ? &pVector[*index] : nullptr;
+}
+
+libOpenCOR::SedInstanceTaskPtr toSedInstanceTask(const Napi::CallbackInfo &pInfo)
+{
+    auto sedInstance = toSedInstance(pInfo[0]);
+
+    if (sedInstance == nullptr) {
+        return nullptr;
+    }
+
+    auto index = toIndex(pInfo[1], sedInstance->taskCount());
+
+    return index.has_value() ? sedInstance->task(*index) : nullptr;
+}
+
+const SedInstanceTaskResults *cachedTaskResults(const Napi::CallbackInfo &pInfo)
+{
+    // Return the results of the given task if they come from our results cache or from disk.
+    // Note: retrieving results counts as using them, which only marks them as the most recently used ones.
+
+    auto id = toSizeT(pInfo[0]);
+
+    sedInstanceTouch(pInfo.Env(), id);
+
+    auto &cachedResults = envData(pInfo.Env()).sedInstanceCachedResults;
+    auto results = cachedResults.find(id);
+
+    if (results == cachedResults.end()) {
+        return nullptr;
+    }
+
+    return toElement(*results->second, pInfo[1]);
+}
+
+const SedInstanceTaskInfo *sedInstanceTaskInfo(const Napi::CallbackInfo &pInfo)
+{
+    // Return the names and units of the variables of the given task if it has no libOpenCOR instance, i.e. if its
+    // results come from our results cache or if its instance got released by our memory accounting.
+
+    auto &sedInstanceMemory = envData(pInfo.Env()).sedInstanceMemory;
+    auto memory = sedInstanceMemory.find(toSizeT(pInfo[0]));
+
+    if (memory == sedInstanceMemory.end()) {
+        return nullptr;
+    }
+
+    return toElement(memory->second.taskInfos, pInfo[1]);
+}
+
+} // namespace
+
+napi_value sedInstanceTaskResultsAvailable(const Napi::CallbackInfo &pInfo)
+{
+    // Results are not available if they were evicted by our memory accounting, in which case they need to be reloaded
+    // from disk, if they were spilled, or the simulation needs to be run again to get them back.
+
+    auto &sedInstanceMemory = envData(pInfo.Env()).sedInstanceMemory;
+    auto memory = sedInstanceMemory.find(toSizeT(pInfo[0]));
+
+    return Napi::Boolean::New(pInfo.Env(), (memory == sedInstanceMemory.end()) || !memory->second.evicted);
+}
 
 napi_value sedInstanceTaskVoiName(const Napi::CallbackInfo &pInfo)
 {
-    auto sedInstance = toSedInstance(toSizeT(pInfo[0]));
-    auto task = sedInstance->task(toInt32(pInfo[1]));
+    auto taskInfo = sedInstanceTaskInfo(pInfo);
+
+    if (taskInfo != nullptr) {
+        return Napi::String::New(pInfo.Env(), taskInfo->voiName);
+    }
 
-    return Napi::String::New(pInfo.Env(), task->voiName());
+    auto task = toSedInstanceTask(pInfo);
+
+    return Napi::String::New(pInfo.Env(), (task != nullptr) ? task->voiName() : "");
 }
 
 napi_value sedInstanceTaskVoiUnit(const Napi::CallbackInfo &pInfo)
 {
-    auto sedInstance = toSedInstance(toSizeT(pInfo[0]));
-    auto task = sedInstance->task(toInt32(pInfo[1]));
+    auto taskInfo = sedInstanceTaskInfo(pInfo);
+
+    if (taskInfo != nullptr) {
+        return Napi::String::New(pInfo.Env(), taskInfo->voiUnit);
+    }
 
-    return Napi::String::New(pInfo.Env(), task->voiUnit());
+    auto task = toSedInstanceTask(pInfo);
+
+    return Napi::String::New(pInfo.Env(), (task != nullptr) ? task->voiUnit() : "");
 }
 
 napi_value sedInstanceTaskVoi(const Napi::CallbackInfo &pInfo)
 {
-    auto sedInstance = toSedInstance(toSizeT(pInfo[0]));
-    auto task = sedInstance->task(toInt32(pInfo[1]));
+    auto cachedResults = cachedTaskResults(pInfo);
+
+    if (cachedResults != nullptr) {
+        return doublesToNapiFloat64Array(pInfo.Env(), cachedResults->voi);
+    }
+
+    auto task = toSedInstanceTask(pInfo);
+
+    if (task == nullptr) {
+        return doublesToNapiFloat64Array(pInfo.Env(), {});
+    }
 
     return doublesToNapiFloat64Array(pInfo.Env(), task->voi());
 }
 
 napi_value sedInstanceTaskStateCount(const Napi::CallbackInfo &pInfo)
 {
-    auto sedInstance = toSedInstance(toSizeT(pInfo[0]));
-    auto task = sedInstance->task(toInt32(pInfo[1]));
+    auto taskInfo = sedInstanceTaskInfo(pInfo);
+
+    if (taskInfo != nullptr) {
+        return Napi::Number::New(pInfo.Env(), taskInfo->stateNames.size());
+    }
 
-    return Napi::Number::New(pInfo.Env(), task->stateCount());
+    auto task = toSedInstanceTask(pInfo);
+
+    return Napi::Number::New(pInfo.Env(), (task != nullptr) ? task->stateCount() : 0);
 }
 
 napi_value sedInstanceTaskStateName(const Napi::CallbackInfo &pInfo)
 {
-    auto sedInstance = toSedInstance(toSizeT(pInfo[0]));
-    auto task = sedInstance->task(toInt32(pInfo[1]));
+    auto taskInfo = sedInstanceTaskInfo(pInfo);
+
+    if (taskInfo != nullptr) {
+        auto stateName = toElement(taskInfo->stateNames, pInfo[2]);
+
+        return Napi::String::New(pInfo.Env(), (stateName != nullptr) ? *stateName : "");
+    }
+
+    auto task = toSedInstanceTask(pInfo);
+    auto index = (task != nullptr) ? toIndex(pInfo[2], task->stateCount()) : std::nullopt;
 
-    return Napi::String::New(pInfo.Env(), task->stateName(toInt32(pInfo[2])));
+    return Napi::String::New(pInfo.Env(), index.has_value() ? task->stateName(*index) : "");
 }
 
 napi_value sedInstanceTaskStateUnit(const Napi::CallbackInfo &pInfo)
 {
-    auto sedInstance = toSedInstance(toSizeT(pInfo[0]));
-    auto task = sedInstance->task(toInt32(pInfo[1]));
+    auto taskInfo = sedInstanceTaskInfo(pInfo);
+
+    if (taskInfo != nullptr) {
+        auto stateUnit = toElement(taskInfo->stateUnits, pInfo[2]);
 
-    return Napi::String::New(pInfo.Env(), task->stateUnit(toInt32(pInfo[2])));
+        return Napi::String::New(pInfo.Env(), (stateUnit != nullptr) ? *stateUnit : "");
+    }
+
+    auto task = toSedInstanceTask(pInfo);
+    auto index = (task != nullptr) ? toIndex(pInfo[2], task->stateCount()) : std::nullopt;
+
+    return Napi::String::New(pInfo.Env(), index.has_value() ? task->stateUnit(*index) : "");
 }
 
 napi_value sedInstanceTaskState(const Napi::CallbackInfo &pInfo)
 {
-    auto sedInstance = toSedInstance(toSizeT(pInfo[0]));
-    auto task = sedInstance->task(toInt32(pInfo[1]));
+    auto cachedResults = cachedTaskResults(pInfo);
+
+    if (cachedResults != nullptr) {
+        auto state = toElement(cachedResults->states, pInfo[2]);
+
+        if (state == nullptr) {
+            return doublesToNapiFloat64Array(pInfo.Env(), {});
+        }
+
+        return doublesToNapiFloat64Array(pInfo.Env(), *state);
+    }
+
+    auto task = toSedInstanceTask(pInfo);
+    auto index = (task != nullptr) ? toIndex(pInfo[2], task->stateCount()) : std::nullopt;
+
+    if (!index.has_value()) {
+        return doublesToNapiFloat64Array(pInfo.Env(), {});
+    }
 
-    return doublesToNapiFloat64Array(pInfo.Env(), task->state(toInt32(pInfo[2])));
+    return doublesToNapiFloat64Array(pInfo.Env(), task->state(*index));
 }
 
 napi_value sedInstanceTaskRateCount(const Napi::CallbackInfo &pInfo)
 {
-    auto sedInstance = toSedInstance(toSizeT(pInfo[0]));
-    auto task = sedInstance->task(toInt32(pInfo[1]));
+    auto taskInfo = sedInstanceTaskInfo(pInfo);
+
+    if (taskInfo != nullptr) {
+        return Napi::Number::New(pInfo.Env(), taskInfo->rateNames.size());
+    }
 
-    return Napi::Number::New(pInfo.Env(), task->rateCount());
+    auto task = toSedInstanceTask(pInfo);
+
+    return Napi::Number::New(pInfo.Env(), (task != nullptr) ? task->rateCount() : 0);
 }
 
 napi_value sedInstanceTaskRateName(const Napi::CallbackInfo &pInfo)
 {
-    auto sedInstance = toSedInstance(toSizeT(pInfo[0]));
-    auto task = sedInstance->task(toInt32(pInfo[1]));
+    auto taskInfo = sedInstanceTaskInfo(pInfo);
+
+    if (taskInfo != nullptr) {
+        auto rateName = toElement(taskInfo->rateNames, pInfo[2]);
+
+        return Napi::String::New(pInfo.Env(), (rateName != nullptr) ? *rateName : "");
+    }
+
+    auto task = toSedInstanceTask(pInfo);
+    auto index = (task != nullptr) ? toIndex(pInfo[2], task->rateCount()) : std::nullopt;
 
-    return Napi::String::New(pInfo.Env(), task->rateName(toInt32(pInfo[2])));
+    return Napi::String::New(pInfo.Env(), index.has_value() ? task->rateName(*index) : "");
 }
 
 napi_value sedInstanceTaskRateUnit(const Napi::CallbackInfo &pInfo)
 {
-    auto sedInstance = toSedInstance(toSizeT(pInfo[0]));
-    auto task = sedInstance->task(toInt32(pInfo[1]));
+    auto taskInfo = sedInstanceTaskInfo(pInfo);
+
+    if (taskInfo != nullptr) {
+        auto rateUnit = toElement(taskInfo->rateUnits, pInfo[2]);
 
-    return Napi::String::New(pInfo.Env(), task->rateUnit(toInt32(pInfo[2])));
+        return Napi::String::New(pInfo.Env(), (rateUnit != nullptr) ? *rateUnit : "");
+    }
+
+    auto task = toSedInstanceTask(pInfo);
+    auto index = (task != nullptr) ? toIndex(pInfo[2], task->rateCount()) : std::nullopt;
+
+    return Napi::String::New(pInfo.Env(), index.has_value() ? task->rateUnit(*index) : "");
 }
 
 napi_value sedInstanceTaskRate(const Napi::CallbackInfo &pInfo)
 {
-    auto sedInstance = toSedInstance(toSizeT(pInfo[0]));
-    auto task = sedInstance->task(toInt32(pInfo[1]));
+    auto cachedResults = cachedTaskResults(pInfo);
 
-    return doublesToNapiFloat64Array(pInfo.Env(), task->rate(toInt32(pInfo[2])));
+    if (cachedResults != nullptr) {
+        auto rate = toElement(cachedResults->rates, pInfo[2]);
+
+        if (rate == nullptr) {
+            return doublesToNapiFloat64Array(pInfo.Env(), {});
+        }
+
+        return doublesToNapiFloat64Array(pInfo.Env(), *rate);
+    }
+
+    auto task = toSedInstanceTask(pInfo);
+    auto index = (task != nullptr) ? toIndex(pInfo[2], task->rateCount()) : std::nullopt;
+
+    if (!index.has_value()) {
+        return doublesToNapiFloat64Array(pInfo.Env(), {});
+    }
+
+    return doublesToNapiFloat64Array(pInfo.Env(), task->rate(*index));
 }
 
 napi_value sedInstanceTaskConstantCount(const Napi::CallbackInfo &pInfo)
 {
-    auto sedInstance = toSedInstance(toSizeT(pInfo[0]));
-    auto task = sedInstance->task(toInt32(pInfo[1]));
+    auto taskInfo = sedInstanceTaskInfo(pInfo);
+
+    if (taskInfo != nullptr) {
+        return Napi::Number::New(pInfo.Env(), taskInfo->constantNames.size());
+    }
 
-    return Napi::Number::New(pInfo.Env(), task->constantCount());
+    auto task = toSedInstanceTask(pInfo);
+
+    return Napi::Number::New(pInfo.Env(), (task != nullptr) ? task->constantCount() : 0);
 }
 
 napi_value sedInstanceTaskConstantName(const Napi::CallbackInfo &pInfo)
 {
-    auto sedInstance = toSedInstance(toSizeT(pInfo[0]));
-    auto task = sedInstance->task(toInt32(pInfo[1]));
+    auto taskInfo = sedInstanceTaskInfo(pInfo);
+
+    if (taskInfo != nullptr) {
+        auto constantName = toElement(taskInfo->constantNames, pInfo[2]);
+
+        return Napi::String::New(pInfo.Env(), (constantName != nullptr) ? *constantName : "");
+    }
+
+    auto task = toSedInstanceTask(pInfo);
+    auto index = (task != nullptr) ? toIndex(pInfo[2], task->constantCount()) : std::nullopt;
 
-    return Napi::String::New(pInfo.Env(), task->constantName(toInt32(pInfo[2])));
+    return Napi::String::New(pInfo.Env(), index.has_value() ? task->constantName(*index) : "");
 }
 
 napi_value sedInstanceTaskConstantUnit(const Napi::CallbackInfo &pInfo)
 {
-    auto sedInstance = toSedInstance(toSizeT(pInfo[0]));
-    auto task = sedInstance->task(toInt32(pInfo[1]));
+    auto taskInfo = sedInstanceTaskInfo(pInfo);
 
-    return Napi::String::New(pInfo.Env(), task->constantUnit(toInt32(pInfo[2])));
+    if (taskInfo != nullptr) {
+        auto constantUnit = toElement(taskInfo->constantUnits, pInfo[2]);
+
+        return Napi::String::New(pInfo.Env(), (constantUnit != nullptr) ? *constantUnit : "");
+    }
+
+    auto task = toSedInstanceTask(pInfo);
+    auto index = (task != nullptr) ? toIndex(pInfo[2], task->constantCount()) : std::nullopt;
+
+    return Napi::String::New(pInfo.Env(), index.has_value() ? task->constantUnit(*index) : "");
 }
 
 napi_value sedInstanceTaskConstant(const Napi::CallbackInfo &pInfo)
 {
-    auto sedInstance = toSedInstance(toSizeT(pInfo[0]));
-    auto task = sedInstance->task(toInt32(pInfo[1]));
+    auto cachedResults = cachedTaskResults(pInfo);
+
+    if (cachedResults != nullptr) {
+        auto constant = toElement(cachedResults->constants, pInfo[2]);
+
+        if (constant == nullptr) {
+            return doublesToNapiFloat64Array(pInfo.Env(), {});
+        }
 
-    return doublesToNapiFloat64Array(pInfo.Env(), task->constant(toInt32(pInfo[2])));
+        return doublesToNapiFloat64Array(pInfo.Env(), *constant);
+    }
+
+    auto task = toSedInstanceTask(pInfo);
+    auto index = (task != nullptr) ? toIndex(pInfo[2], task->constantCount()) : std::nullopt;
+
+    if (!index.has_value()) {
+        return doublesToNapiFloat64Array(pInfo.Env(), {});
+    }
+
+    return doublesToNapiFloat64Array(pInfo.Env(), task->constant(*index));
 }
 
 napi_value sedInstanceTaskComputedConstantCount(const Napi::CallbackInfo &pInfo)
 {
-    auto sedInstance = toSedInstance(toSizeT(pInfo[0]));
-    auto task = sedInstance->task(toInt32(pInfo[1]));
+    auto taskInfo = sedInstanceTaskInfo(pInfo);
+
+    if (taskInfo != nullptr) {
+        return Napi::Number::New(pInfo.Env(), taskInfo->computedConstantNames.size());
+    }
+
+    auto task = toSedInstanceTask(pInfo);
 
-    return Napi::Number::New(pInfo.Env(), task->computedConstantCount());
+    return Napi::Number::New(pInfo.Env(), (task != nullptr) ? task->computedConstantCount() : 0);
 }
 
 napi_value sedInstanceTaskComputedConstantName(const Napi::CallbackInfo &pInfo)
 {
-    auto sedInstance = toSedInstance(toSizeT(pInfo[0]));
-    auto task = sedInstance->task(toInt32(pInfo[1]));
+    auto taskInfo = sedInstanceTaskInfo(pInfo);
+
+    if (taskInfo != nullptr) {
+        auto computedConstantName = toElement(taskInfo->computedConstantNames, pInfo[2]);
+
+        return Napi::String::New(pInfo.Env(), (computedConstantName != nullptr) ? *computedConstantName : "");
+    }
+
+    auto task = toSedInstanceTask(pInfo);
+    auto index = (task != nullptr) ? toIndex(pInfo[2], task->computedConstantCount()) : std::nullopt;
 
-    return Napi::String::New(pInfo.Env(), task->computedConstantName(toInt32(pInfo[2])));
+    return Napi::String::New(pInfo.Env(), index.has_value() ? task->computedConstantName(*index) : "");
 }
 
 napi_value sedInstanceTaskComputedConstantUnit(const Napi::CallbackInfo &pInfo)
 {
-    auto sedInstance = toSedInstance(toSizeT(pInfo[0]));
-    auto task = sedInstance->task(toInt32(pInfo[1]));
+    auto taskInfo = sedInstanceTaskInfo(pInfo);
 
-    return Napi::String::New(pInfo.Env(), task->computedConstantUnit(toInt32(pInfo[2])));
+    if (taskInfo != nullptr) {
+        auto computedConstantUnit = toElement(taskInfo->computedConstantUnits, pInfo[2]);
+
+        return Napi::String::New(pInfo.Env(), (computedConstantUnit != nullptr) ? *computedConstantUnit : "");
+    }
+
+    auto task = toSedInstanceTask(pInfo);
+    auto index = (task != nullptr) ? toIndex(pInfo[2], task->computedConstantCount()) : std::nullopt;
+
+    return Napi::String::New(pInfo.Env(), index.has_value() ? task->computedConstantUnit(*index) : "");
 }
 
 napi_value sedInstanceTaskComputedConstant(const Napi::CallbackInfo &pInfo)
 {
-    auto sedInstance = toSedInstance(toSizeT(pInfo[0]));
-    auto task = sedInstance->task(toInt32(pInfo[1]));
+    auto cachedResults = cachedTaskResults(pInfo);
+
+    if (cachedResults != nullptr) {
+        auto computedConstant = toElement(cachedResults->computedConstants, pInfo[2]);
+
+        if (computedConstant == nullptr) {
+            return doublesToNapiFloat64Array(pInfo.Env(), {});
+        }
 
-    return doublesToNapiFloat64Array(pInfo.Env(), task->computedConstant(toInt32(pInfo[2])));
+        return doublesToNapiFloat64Array(pInfo.Env(), *computedConstant);
+    }
+
+    auto task = toSedInstanceTask(pInfo);
+    auto index = (task != nullptr) ? toIndex(pInfo[2], task->computedConstantCount()) : std::nullopt;
+
+    if (!index.has_value()) {
+        return doublesToNapiFloat64Array(pInfo.Env(), {});
+    }
+
+    return doublesToNapiFloat64Array(pInfo.Env(), task->computedConstant(*index));
 }
 
 napi_value sedInstanceTaskAlgebraicVariableCount(const Napi::CallbackInfo &pInfo)
 {
-    auto sedInstance = toSedInstance(toSizeT(pInfo[0]));
-    auto task = sedInstance->task(toInt32(pInfo[1]));
+    auto taskInfo = sedInstanceTaskInfo(pInfo);
+
+    if (taskInfo != nullptr) {
+        return Napi::Number::New(pInfo.Env(), taskInfo->algebraicVariableNames.size());
+    }
+
+    auto task = toSedInstanceTask(pInfo);
 
-    return Napi::Number::New(pInfo.Env(), task->algebraicVariableCount());
+    return Napi::Number::New(pInfo.Env(), (task != nullptr) ? task->algebraicVariableCount() : 0);
 }
 
 napi_value sedInstanceTaskAlgebraicVariableName(const Napi::CallbackInfo &pInfo)
 {
-    auto sedInstance = toSedInstance(toSizeT(pInfo[0]));
-    auto task = sedInstance->task(toInt32(pInfo[1]));
+    auto taskInfo = sedInstanceTaskInfo(pInfo);
+
+    if (taskInfo != nullptr) {
+        auto algebraicVariableName = toElement(taskInfo->algebraicVariableNames, pInfo[2]);
+
+        return Napi::String::New(pInfo.Env(), (algebraicVariableName != nullptr) ? *algebraicVariableName : "");
+    }
+
+    auto task = toSedInstanceTask(pInfo);
+    auto index = (task != nullptr) ? toIndex(pInfo[2], task->algebraicVariableCount()) : std::nullopt;
 
-    return Napi::String::New(pInfo.Env(), task->algebraicVariableName(toInt32(pInfo[2])));
+    return Napi::String::New(pInfo.Env(), index.has_value() ? task->algebraicVariableName(*index) : "");
 }
 
 napi_value sedInstanceTaskAlgebraicVariableUnit(const Napi::CallbackInfo &pInfo)
 {
-    auto sedInstance = toSedInstance(toSizeT(pInfo[0]));
-    auto task = sedInstance->task(toInt32(pInfo[1]));
+    auto taskInfo = sedInstanceTaskInfo(pInfo);
 
-    return Napi::String::New(pInfo.Env(), task->algebraicVariableUnit(toInt32(pInfo[2])));
+    if (taskInfo != nullptr) {
+        auto algebraicVariableUnit = toElement(taskInfo->algebraicVariableUnits, pInfo[2]);
+
+        return Napi::String::New(pInfo.Env(), (algebraicVariableUnit != nullptr) ? *algebraicVariableUnit : "");
+    }
+
+    auto task = toSedInstanceTask(pInfo);
+    auto index = (task != nullptr) ? toIndex(pInfo[2], task->algebraicVariableCount()) : std::nullopt;
+
+    return Napi::String::New(pInfo.Env(), index.has_value() ? task->algebraicVariableUnit(*index) : "");
 }
 
 napi_value sedInstanceTaskAlgebraicVariable(const Napi::CallbackInfo &pInfo)
 {
-    auto sedInstance = toSedInstance(toSizeT(pInfo[0]));
-    auto task = sedInstance->task(toInt32(pInfo[1]));
+    auto cachedResults = cachedTaskResults(pInfo);
+
+    if (cachedResults != nullptr) {
+        auto algebraicVariable = toElement(cachedResults->algebraicVariables, pInfo[2]);
+
+        if (algebraicVariable == nullptr) {
+            return doublesToNapiFloat64Array(pInfo.Env(), {});
+        }
+
+        return doublesToNapiFloat64Array(pInfo.Env(), *algebraicVariable);
+    }
+
+    auto task = toSedInstanceTask(pInfo);
+    auto index = (task != nullptr) ? toIndex(pInfo[2], task->algebraicVariableCount()) : std::nullopt;
+
+    if (!index.has_value()) {
+        return doublesToNapiFloat64Array(pInfo.Env(), {});
+    }
 
-    return doublesToNapiFloat64Array(pInfo.Env(), task->algebraicVariable(toInt32(pInfo[2])));
+    return doublesToNapiFloat64Array(pInfo.Env(), task->algebraicVariable(*index));
 }
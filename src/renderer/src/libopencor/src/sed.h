@@ -33,11 +33,40 @@ void sedUniformTimeCourseSetOutputEndTime(const Napi::CallbackInfo &pInfo);
 napi_value sedUniformTimeCourseNumberOfSteps(const Napi::CallbackInfo &pInfo);
 void sedUniformTimeCourseSetNumberOfSteps(const Napi::CallbackInfo &pInfo);
 
+// SedSimulation API.
+
+napi_value sedSimulationOdeSolverType(const Napi::CallbackInfo &pInfo);
+void sedSimulationSetOdeSolverType(const Napi::CallbackInfo &pInfo);
+
 // SolverCvode API.
-// TODO: this is only temporary until we have full support for our different solvers.
 
 napi_value solverCvodeMaximumStep(const Napi::CallbackInfo &pInfo);
 void solverCvodeSetMaximumStep(const Napi::CallbackInfo &pInfo);
+napi_value solverCvodeMaximumNumberOfSteps(const Napi::CallbackInfo &pInfo);
+void solverCvodeSetMaximumNumberOfSteps(const Napi::CallbackInfo &pInfo);
+napi_value solverCvodeIntegrationMethod(const Napi::CallbackInfo &pInfo);
+void solverCvodeSetIntegrationMethod(const Napi::CallbackInfo &pInfo);
+napi_value solverCvodeIterationType(const Napi::CallbackInfo &pInfo);
+void solverCvodeSetIterationType(const Napi::CallbackInfo &pInfo);
+napi_value solverCvodeLinearSolver(const Napi::CallbackInfo &pInfo);
+void solverCvodeSetLinearSolver(const Napi::CallbackInfo &pInfo);
+napi_value solverCvodePreconditioner(const Napi::CallbackInfo &pInfo);
+void solverCvodeSetPreconditioner(const Napi::CallbackInfo &pInfo);
+napi_value solverCvodeUpperHalfBandwidth(const Napi::CallbackInfo &pInfo);
+void solverCvodeSetUpperHalfBandwidth(const Napi::CallbackInfo &pInfo);
+napi_value solverCvodeLowerHalfBandwidth(const Napi::CallbackInfo &pInfo);
+void solverCvodeSetLowerHalfBandwidth(const Napi::CallbackInfo &pInfo);
+napi_value solverCvodeRelativeTolerance(const Napi::CallbackInfo &pInfo);
+void solverCvodeSetRelativeTolerance(const Napi::CallbackInfo &pInfo);
+napi_value solverCvodeAbsoluteTolerance(const Napi::CallbackInfo &pInfo);
+void solverCvodeSetAbsoluteTolerance(const Napi::CallbackInfo &pInfo);
+napi_value solverCvodeInterpolateSolution(const Napi::CallbackInfo &pInfo);
+void solverCvodeSetInterpolateSolution(const Napi::CallbackInfo &pInfo);
+
+// SolverFixedStep API.
+
+napi_value solverFixedStepStep(const Napi::CallbackInfo &pInfo);
+void solverFixedStepSetStep(const Napi::CallbackInfo &pInfo);
 
 // SedInstance API.
 
@@ -50,9 +79,11 @@ napi_value sedInstanceWaitForRun(const Napi::CallbackInfo &pInfo);
 void sedInstancePauseRun(const Napi::CallbackInfo &pInfo);
 void sedInstanceResumeRun(const Napi::CallbackInfo &pInfo);
 void sedInstanceStopRun(const Napi::CallbackInfo &pInfo);
+napi_value sedInstanceResultBytes(const Napi::CallbackInfo &pInfo);
 
 // SedInstanceTask API.
 
+napi_value sedInstanceTaskResultsAvailable(const Napi::CallbackInfo &pInfo);
 napi_value sedInstanceTaskVoiName(const Napi::CallbackInfo &pInfo);
 napi_value sedInstanceTaskVoiUnit(const Napi::CallbackInfo &pInfo);
 napi_value sedInstanceTaskVoi(const Napi::CallbackInfo &pInfo);